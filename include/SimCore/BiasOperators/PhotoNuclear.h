@@ -53,6 +53,9 @@ class PhotoNuclear : public XsecBiasingOperator {
   /** Cross-section biasing operation for conversion process */
   G4BOptnChangeCrossSection* emXsecOperation{nullptr};
 
+  /** Biased conversion process, nullptr if conversion isn't biased */
+  const G4VProcess* conversionProcess_{nullptr};
+
   /** Unbiased photonuclear xsec. */
   double pnXsecUnbiased_{0};
 
@@ -7,6 +7,10 @@
 #ifndef SIMCORE_EVENT_SIMCALORIMETERHIT_H_
 #define SIMCORE_EVENT_SIMCALORIMETERHIT_H_
 
+// STL
+#include <cstdint>
+#include <unordered_map>
+
 // ROOT
 #include "TObject.h"  //For ClassDef
 
@@ -77,6 +81,18 @@ class SimCalorimeterHit {
    */
   virtual ~SimCalorimeterHit() = default;
 
+  /**
+   * Copy and move constructors and assignments.
+   *
+   * The virtual destructor would otherwise suppress the implicit move
+   * operations, so every hit moved by a growing or sorted vector would
+   * deep copy its contribution vectors.
+   */
+  SimCalorimeterHit(const SimCalorimeterHit &) = default;
+  SimCalorimeterHit(SimCalorimeterHit &&) = default;
+  SimCalorimeterHit &operator=(const SimCalorimeterHit &) = default;
+  SimCalorimeterHit &operator=(SimCalorimeterHit &&) = default;
+
   /**
    * Clear the data in the object.
    */
@@ -242,6 +258,16 @@ class SimCalorimeterHit {
   void addContrib(int incidentID, int trackID, int pdgCode, float edep,
                   float time);
 
+  /**
+   * Reserve space for a number of hit contributions.
+   *
+   * Used when the number of contributions is known before they are
+   * added, so their vectors are allocated once at that size.
+   *
+   * @param n The number of contributions to reserve space for.
+   */
+  void reserveContribs(unsigned n);
+
   /**
    * Get a hit contribution by index.
    * @param i The index of the hit contribution.
@@ -251,12 +277,33 @@ class SimCalorimeterHit {
 
   /**
    * Find the index of a hit contribution from a SimParticle and PDG code.
+   *
+   * Once the hit has more than a few contributions, an index from the
+   * track ID and PDG code to the contribution is built and kept up to
+   * date by addContrib, so finding a contribution doesn't have to look
+   * through all of them. The index is transient and isn't persisted. It
+   * remembers how many contributions it covers and is built again when
+   * that isn't the number of contributions of the hit, which is the case
+   * after ROOT reads a new entry into a reused hit.
+   *
    * @param trackID the track ID of the particle causing the hit
    * @param pdgCode The PDG code of the contribution.
    * @return The index of the contribution or -1 if none exists.
    */
   int findContribIndex(int trackID, int pdgCode) const;
 
+  /**
+   * Release the memory used by the index of the contributions.
+   *
+   * The sensitive detectors do this in prepareHits, once all of the
+   * contributions have been added and before the hit is copied into the
+   * event.
+   */
+  void releaseContribIndex() {
+    std::unordered_map<std::uint64_t, int>().swap(contribIndex_);
+    contribIndexSize_ = 0;
+  }
+
   /**
    * Update an existing hit contribution by incrementing its edep and setting
    * the time if the new time is less than the old one.
@@ -337,6 +384,18 @@ class SimCalorimeterHit {
    */
   unsigned nContribs_{0};
 
+  /**
+   * Index from the track ID and PDG code of a contribution to its index,
+   * empty until there are more than a few contributions.
+   */
+  mutable std::unordered_map<std::uint64_t, int> contribIndex_;  //!
+
+  /**
+   * The number of contributions in the index, it is out of date if this
+   * isn't nContribs_.
+   */
+  mutable unsigned contribIndexSize_{0};  //!
+
   /*
    * Parameters used only for hits corresponding to a single interactions
    * (currently Hcal and TS).
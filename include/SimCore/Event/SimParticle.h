@@ -58,6 +58,12 @@ class SimParticle {
   /// Destructor
   virtual ~SimParticle() = default;
 
+  /// Copy and move, spelled out so the virtual destructor keeps the moves
+  SimParticle(const SimParticle&) = default;
+  SimParticle(SimParticle&&) = default;
+  SimParticle& operator=(const SimParticle&) = default;
+  SimParticle& operator=(SimParticle&&) = default;
+
   /// Reset an instance of this class by clearing all of its data.
   void Clear();
 
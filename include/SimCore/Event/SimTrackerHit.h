@@ -33,6 +33,15 @@ class SimTrackerHit {
    */
   virtual ~SimTrackerHit();
 
+  /**
+   * Copy and move constructors and assignments, declared explicitly
+   * since the user-declared destructor removes the implicit moves.
+   */
+  SimTrackerHit(const SimTrackerHit &) = default;
+  SimTrackerHit(SimTrackerHit &&) = default;
+  SimTrackerHit &operator=(const SimTrackerHit &) = default;
+  SimTrackerHit &operator=(SimTrackerHit &&) = default;
+
   /**
    * Print a description of this object.
    */
@@ -0,0 +1,69 @@
+/**
+ * @file EventSeeds.h
+ * @brief Compact per-event seeds derived from the seeds of the run
+ */
+
+#ifndef SIMCORE_EVENTSEEDS_H_
+#define SIMCORE_EVENTSEEDS_H_
+
+/*~~~~~~~~~~~~~~~~*/
+/*   C++ StdLib   */
+/*~~~~~~~~~~~~~~~~*/
+#include <string>
+#include <vector>
+
+/*~~~~~~~~~~~~~~~*/
+/*   Framework   */
+/*~~~~~~~~~~~~~~~*/
+#include "Framework/EventHeader.h"
+#include "Framework/RunHeader.h"
+
+namespace simcore {
+
+/// name of the run header parameter recording if the events have compact seeds
+const std::string COMPACT_EVENT_SEEDS_PARAMETER{"Compact Event Seeds"};
+
+/**
+ * Derive the seeds for a single event
+ *
+ * The seeds only depend on the seeds of the run and the run and event
+ * numbers, so the same event can be simulated again on any worker and
+ * in any order from just these two integers.
+ *
+ * The seeds are positive, so they survive the round trip through the
+ * integer parameters of the event header, and never zero, since the
+ * random engine takes a zero as the end of its array of seeds.
+ *
+ * @throws Exception if there are less than two seeds for the run
+ *
+ * @param[in] run_seeds the seeds of the run
+ * @param[in] run the number of the run
+ * @param[in] event the number of the event to derive the seeds for
+ * @return the two seeds to pass to the G4 random engine
+ */
+std::vector<int> deriveEventSeeds(const std::vector<int>& run_seeds, int run,
+                                  int event);
+
+/**
+ * Check if the events of a run were seeded from compact event seeds
+ *
+ * Runs simulated before the mode was recorded in the run header stored
+ * the full state of the random engine for each event.
+ *
+ * @param[in] header the header of the run
+ * @return true if the event headers have compact seeds
+ */
+bool hasCompactEventSeeds(const ldmx::RunHeader& header);
+
+/**
+ * Set up the random engine the way it was when an event was simulated
+ *
+ * @param[in] header the header of the event to simulate again
+ * @param[in] compact true if the event was seeded from compact seeds,
+ * false if the full state of the engine was stored
+ */
+void restoreEventSeeds(const ldmx::EventHeader& header, bool compact);
+
+}  // namespace simcore
+
+#endif  // SIMCORE_EVENTSEEDS_H_
@@ -6,6 +6,7 @@
 #include <memory>                   // for the unique_ptr default
 #include <string>                   // for the keys in the library map
 #include <unordered_map>            // for the library of prototypes
+#include <vector>                   // for the warehouse of objects
 
 #include "Framework/Exception/Exception.h"
 
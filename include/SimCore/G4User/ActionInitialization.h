@@ -0,0 +1,60 @@
+/**
+ * @file ActionInitialization.h
+ * @brief Class which creates the Geant4 user actions
+ */
+
+#ifndef SIMCORE_G4USER_ACTIONINITIALIZATION_H
+#define SIMCORE_G4USER_ACTIONINITIALIZATION_H
+
+/*~~~~~~~~~~~~*/
+/*   Geant4   */
+/*~~~~~~~~~~~~*/
+#include "G4VUserActionInitialization.hh"
+
+/*~~~~~~~~~~~~~~~*/
+/*   Framework   */
+/*~~~~~~~~~~~~~~~*/
+#include "Framework/Configure/Parameters.h"
+
+namespace simcore::g4user {
+
+/**
+ * @class ActionInitialization
+ * @brief Creates our G4User actions and attaches the UserActions to them
+ *
+ * Geant4 calls Build once for a sequential run manager and once on each
+ * worker thread for a multi-threaded run manager. Only the G4User actions
+ * and the TrackMap owned by the TrackingAction are created anew in each
+ * Build. The primary generators and the UserActions are kept in the
+ * global warehouse of their Factory, so they would be shared by all the
+ * workers of a multi-threaded run.
+ */
+class ActionInitialization : public G4VUserActionInitialization {
+ public:
+  /**
+   * Constructor
+   *
+   * @param[in] parameters The parameters used to configure the simulation.
+   */
+  ActionInitialization(const framework::config::Parameters& parameters);
+
+  /// Destructor
+  virtual ~ActionInitialization() = default;
+
+  /**
+   * Create the G4User actions and register them with the run manager.
+   *
+   * The UserActions configured in the 'actions' parameter are created
+   * and attached to the G4User action corresponding to each of their
+   * types.
+   */
+  void Build() const final override;
+
+ private:
+  /// The parameters used to configure the simulation
+  framework::config::Parameters parameters_;
+};  // ActionInitialization
+
+}  // namespace simcore::g4user
+
+#endif  // SIMCORE_G4USER_ACTIONINITIALIZATION_H
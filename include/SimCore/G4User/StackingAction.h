@@ -15,8 +15,14 @@
 /*~~~~~~~~~~~~*/
 /*   Geant4   */
 /*~~~~~~~~~~~~*/
+#include "G4Region.hh"
 #include "G4UserStackingAction.hh"
 
+/*~~~~~~~~~~~~~~~*/
+/*   Framework   */
+/*~~~~~~~~~~~~~~~*/
+#include "Framework/Configure/Parameters.h"
+
 /*~~~~~~~~~~~~~*/
 /*   SimCore   */
 /*~~~~~~~~~~~~~*/
@@ -28,11 +34,23 @@ namespace g4user {
 /**
  * @class StackingAction
  * @brief Class implementing a user stacking action.
+ *
+ * If staging is enabled, only the primaries and the tracks passing the
+ * stage one predicate (created in one of the stage one regions with at
+ * least the stage one kinetic energy) are tracked in the first stage.
+ * All other tracks wait for the next stage. At each new stage, the
+ * stacking UserActions are asked if the event should be aborted before
+ * the waiting tracks are processed, so filters can reject an event
+ * before paying for the rest of its showers.
  */
 class StackingAction : public G4UserStackingAction {
  public:
-  /// Constructor
-  StackingAction() = default;
+  /**
+   * Constructor
+   *
+   * @param[in] parameters the 'stacking' parameters of the simulation
+   */
+  StackingAction(const framework::config::Parameters& parameters);
 
   /// Destructor
   virtual ~StackingAction() = default;
@@ -46,6 +64,8 @@ class StackingAction : public G4UserStackingAction {
 
   /**
    * Invoked when there is a new stacking stage.
+   *
+   * If any of the stacking UserActions want to, the event is aborted.
    */
   void NewStage() override;
 
@@ -63,10 +83,31 @@ class StackingAction : public G4UserStackingAction {
     stackingActions_.push_back(stackingAction);
   }
 
+ private:
+  /**
+   * Should the input track be processed in the first stage?
+   *
+   * @param[in] track new track to check
+   * @return true if the track passes the stage one predicate
+   */
+  bool isStageOne(const G4Track* track) const;
+
  private:
   /// Collection of user stacking actions
   std::vector<UserAction*> stackingActions_;
 
+  /// Should tracks not passing the stage one predicate wait?
+  bool enable_staging_;
+
+  /// Regions that tracks need to be created in for stage one (any if empty)
+  std::vector<const G4Region*> stage_one_regions_;
+
+  /// Minimum kinetic energy of tracks for stage one [MeV]
+  double stage_one_min_energy_;
+
+  /// Number of stages that have been completed in this event
+  int stages_completed_{0};
+
 };  // StackingAction
 
 }  // namespace g4user
@@ -111,6 +111,10 @@ class TrackingAction : public G4UserTrackingAction {
 
   /**
    * Get a pointer to the current UserTrackingAction from the G4RunManager.
+   *
+   * The G4RunManager pointer is thread-local, so on a worker thread
+   * this is the tracking action (and TrackMap) of that worker.
+   *
    * @return A pointer to the current UserTrackingAction.
    */
   static TrackingAction* get() {
@@ -78,12 +78,26 @@ class MagneticFieldMap3D : public G4MagneticField {
   void GetFieldValue(const double point[4], double* bfield) const;
 
  private:
+  /**
+   * Get the value of a field component at a grid point
+   *
+   * @param[in] ix, iy, iz indices of the grid point
+   * @param[in] component 0, 1 or 2 for the X, Y or Z component of the field
+   * @return value of the field component at the grid point
+   */
+  double at(int ix, int iy, int iz, int component) const {
+    return field_[((ix * ny_ + iy) * nz_ + iz) * 3 + component];
+  }
+
   /*
    * Storage space for the table.
+   *
+   * The three field components of each grid point are stored next to each
+   * other and the grid points are stored with z varying fastest, so the
+   * corners of a grid cell read by GetFieldValue are close together in
+   * memory and the table is loaded with a single allocation.
    */
-  vector<vector<vector<double>>> xField_;
-  vector<vector<vector<double>>> yField_;
-  vector<vector<vector<double>>> zField_;
+  vector<double> field_;
 
   /*
    * The dimensions of the table.
@@ -0,0 +1,138 @@
+/**
+ * @file ProcessRegistry.h
+ * @brief Class mapping the Geant4 processes to their identity in ldmx-sw
+ */
+
+#ifndef SIMCORE_PROCESSREGISTRY_H_
+#define SIMCORE_PROCESSREGISTRY_H_
+
+/*~~~~~~~~~~~~~~~~*/
+/*   C++ StdLib   */
+/*~~~~~~~~~~~~~~~~*/
+#include <unordered_map>
+
+/*~~~~~~~~~~~~~*/
+/*   SimCore   */
+/*~~~~~~~~~~~~~*/
+#include "SimCore/Event/SimParticle.h"
+
+class G4VProcess;
+
+namespace simcore {
+
+/**
+ * @class ProcessRegistry
+ * @brief Map from the processes attached to the particles to their
+ * ldmx::SimParticle::ProcessType and to the roles we look for in them
+ *
+ * The registry is built once the physics list has been constructed, so
+ * that identifying the process which created a track or limited a step
+ * is a single hash lookup instead of comparing process names. Biasing
+ * wrappers are registered alongside the processes they wrap, so both
+ * resolve to the same type and roles.
+ *
+ * A process which isn't registered (e.g. one attached after the registry
+ * was built) is identified by its name, just like before the registry
+ * existed, so the registry never changes the result of a lookup.
+ *
+ * Geant4 constructs separate processes on each worker thread, so there
+ * is one registry per thread.
+ */
+class ProcessRegistry {
+ public:
+  /// The roles of a process that we look for during the simulation
+  enum Role : unsigned {
+    /// no special role
+    NONE = 0,
+    /// photo-nuclear interaction
+    PHOTO_NUCLEAR = 1 << 0,
+    /// electro-nuclear interaction
+    ELECTRO_NUCLEAR = 1 << 1,
+    /// dark bremsstrahlung
+    DARK_BREM = 1 << 2
+  };
+
+  /**
+   * Get the registry of this thread.
+   * @return The process registry.
+   */
+  static ProcessRegistry& getInstance();
+
+  /**
+   * Register the processes attached to every particle in the particle
+   * table, replacing anything registered before.
+   *
+   * This needs to be called after the physics list has been constructed
+   * i.e. after G4RunManager::Initialize.
+   */
+  void build();
+
+  /**
+   * Get the process type of a process
+   *
+   * @param[in] process the process to look up, may be a biasing wrapper
+   * @return the process type, unknown if process is null
+   */
+  ldmx::SimParticle::ProcessType getType(const G4VProcess* process) const;
+
+  /**
+   * Check if a process has a role
+   *
+   * @param[in] process the process to look up, may be a biasing wrapper
+   * @param[in] role the role to check for
+   * @return true if the process is non-null and has the role
+   */
+  bool is(const G4VProcess* process, Role role) const {
+    return (getRoles(process) & role) != 0;
+  }
+
+  /**
+   * Get the dark brem process attached to the electron
+   *
+   * This is the process in the electron's process list, so it is the
+   * biasing wrapper if the dark brem is biased.
+   *
+   * @return the dark brem process, nullptr if there isn't one
+   */
+  G4VProcess* getElectronDarkBrem() const { return electron_dark_brem_; }
+
+  // Delete the following methods to make sure they are inaccesible.
+  ProcessRegistry(ProcessRegistry const&) = delete;
+  void operator=(ProcessRegistry const&) = delete;
+
+ private:
+  /// Default constructor
+  ProcessRegistry() = default;
+
+  /// The identity of a single process
+  struct Entry {
+    ldmx::SimParticle::ProcessType type;
+    unsigned roles;
+  };
+
+  /**
+   * Identify a process from its name
+   *
+   * @param[in] process the process to identify
+   * @return the type and roles of the process
+   */
+  static Entry identify(const G4VProcess* process);
+
+  /**
+   * Get the roles of a process
+   *
+   * @param[in] process the process to look up
+   * @return the roles of the process, NONE if process is null
+   */
+  unsigned getRoles(const G4VProcess* process) const;
+
+  /// the registered processes
+  std::unordered_map<const G4VProcess*, Entry> entries_;
+
+  /// the dark brem process attached to the electron
+  G4VProcess* electron_dark_brem_{nullptr};
+};
+
+}  // namespace simcore
+
+#endif  // SIMCORE_PROCESSREGISTRY_H_
@@ -17,6 +17,12 @@ class ReSimulator : public SimulatorBase {
    * @param parameters ParameterSet for configuration.
    */
   void configure(framework::config::Parameters& parameters) final override;
+  /**
+   * Find out how the events of the input run were seeded
+   *
+   * @param header RunHeader of the input run
+   */
+  void onNewRun(const ldmx::RunHeader& header) override;
   /**
    * Run resimulation if the event is part of the requested sets of events to
    * resimulate
@@ -55,6 +61,12 @@ class ReSimulator : public SimulatorBase {
    */
   bool care_about_run_;
 
+  /**
+   * Whether the events of the current input run were seeded from compact
+   * event seeds instead of the full state of the random engine
+   */
+  bool compact_event_seeds_{false};
+
   /*
    * How many events have already been resimulated. This determines the event
    * number in the output file, since more than one input file can be used.
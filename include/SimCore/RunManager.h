@@ -60,6 +60,17 @@ class RunManager : public G4RunManager {
    */
   void Initialize();
 
+  /**
+   * Initialize the run.
+   *
+   * Runs the parent G4RunManager::RunInitialization() which builds the
+   * physics tables (or retrieves them from the cache). If a physics
+   * table cache is configured and the tables were built, they are then
+   * stored in the cache so that later jobs with the same physics
+   * configuration can retrieve them.
+   */
+  void RunInitialization() override;
+
   /**
    * Called at the end of each event.
    *
@@ -108,6 +119,31 @@ class RunManager : public G4RunManager {
    */
   bool useRootSeed_{false};
 
+  /**
+   * Directory in the physics table cache for the current physics
+   * configuration, empty if the cache is not enabled.
+   */
+  std::string physicsTableDir_{""};
+
+  /// Hash of the physics configuration, computed once in Initialize
+  std::string physicsTableKey_{""};
+
+  /// Were the physics tables retrieved from the cache?
+  bool physicsTablesRetrieved_{false};
+
+  /**
+   * Hash the parts of the configuration which determine the content of
+   * the physics tables.
+   *
+   * This includes the Geant4 version, the detector and scoring plane
+   * descriptions along with the files they include, the pre-initialization
+   * commands and the configuration of the physics constructors and models
+   * we register on top of FTFP_BERT.
+   *
+   * @return hexadecimal string of the hash
+   */
+  std::string physicsTableKey() const;
+
 };  // RunManager
 }  // namespace simcore
 
@@ -0,0 +1,209 @@
+/**
+ * @file EcalHitTable.h
+ * @brief Class accumulating the hits in the ECal cells during an event
+ */
+
+#ifndef SIMCORE_SDS_ECALHITTABLE_H_
+#define SIMCORE_SDS_ECALHITTABLE_H_
+
+/*~~~~~~~~~~~~~~~~*/
+/*   C++ StdLib   */
+/*~~~~~~~~~~~~~~~~*/
+#include <cstddef>
+#include <vector>
+
+/*~~~~~~~~~~~~~~*/
+/*   DetDescr   */
+/*~~~~~~~~~~~~~~*/
+#include "DetDescr/EcalID.h"
+
+/*~~~~~~~~~~~~~*/
+/*   SimCore   */
+/*~~~~~~~~~~~~~*/
+#include "SimCore/Event/SimCalorimeterHit.h"
+
+namespace simcore {
+
+/**
+ * @class EcalHitTable
+ * @brief The hits in the ECal cells and their contributions in an event
+ *
+ * The hits are found through an open-addressing table from the cell ID,
+ * and the contributions are kept in an arena owned by the table, chained
+ * by index for each hit. Both are copied into the hits only once the
+ * event is over, so each hit allocates its contribution vectors once at
+ * their final size.
+ *
+ * Only the slots of the tables that were filled in an event are emptied
+ * by clear, so clearing costs the number of cells hit and not the size
+ * of the tables. Everything keeps its capacity for the next event.
+ *
+ * This doesn't depend on Geant4, the EcalSD works out the cell and the
+ * contributor of each step and passes them on.
+ */
+class EcalHitTable {
+ public:
+  /**
+   * Constructor
+   *
+   * @param[in] enable_contribs keep the contributions to each hit
+   * @param[in] compress_contribs merge the contributions of the same track
+   * and PDG ID to a hit
+   */
+  EcalHitTable(bool enable_contribs, bool compress_contribs)
+      : enable_contribs_{enable_contribs},
+        compress_contribs_{compress_contribs} {}
+
+  /**
+   * Get the hit in the input cell, creating it if it doesn't exist yet
+   *
+   * A hit that was just created is empty, its ID and position are left
+   * to the caller.
+   *
+   * @param[in] id ID of the cell
+   * @param[out] created set to true if the hit was just created
+   * @return the index of the hit in that cell
+   */
+  std::size_t findHit(ldmx::EcalID id, bool& created);
+
+  /**
+   * Get a hit that has been found
+   *
+   * @param[in] i index of the hit from findHit
+   * @return the hit
+   */
+  ldmx::SimCalorimeterHit& getHit(std::size_t i) { return hits_[i]; }
+
+  /**
+   * Add the energy deposited by a step to a hit
+   *
+   * @param[in] hit index of the hit from findHit
+   * @param[in] incident_id track ID of the incident ancestor of the track
+   * @param[in] track_id track ID of the track that took the step
+   * @param[in] pdg PDG ID of the track that took the step
+   * @param[in] edep energy deposited by the step
+   * @param[in] time global time of the step
+   */
+  void addStep(std::size_t hit, int incident_id, int track_id, int pdg,
+               double edep, double time);
+
+  /**
+   * Move the hits of this event into the input collection
+   *
+   * The contributions in the arena are copied into their hits and the
+   * hits are sorted by ID, like they were when they were kept in a map.
+   * The table is left without hits, but clear still has to be called
+   * before the next event.
+   *
+   * @param[out] hits collection to move the hits into, cleared first
+   */
+  void stage(std::vector<ldmx::SimCalorimeterHit>& hits);
+
+  /**
+   * Forget the hits and contributions of this event
+   */
+  void clear();
+
+ private:
+  /// A contribution to a hit, kept in the arena until the hits are staged
+  struct Contrib {
+    /// track ID of the incident ancestor of the contributor
+    int incident_id;
+    /// track ID of the contributor
+    int track_id;
+    /// PDG ID of the contributor
+    int pdg;
+    /// energy deposited by the contributor
+    float edep;
+    /// earliest time of the contributor's steps
+    float time;
+    /// index in contribs_ of the next contribution to the same hit, -1 if none
+    int next;
+  };
+
+  /**
+   * Double the size of the table and re-insert the cells already hit
+   */
+  void growTable();
+
+  /**
+   * Append a new contribution to a hit in the arena
+   *
+   * @param[in] hit index of the hit in hits_
+   * @param[in] track_id track ID of the contributor
+   * @param[in] pdg PDG ID of the contributor
+   * @return the new contribution, with no energy and its incident ID unset
+   */
+  Contrib& newContrib(std::size_t hit, int track_id, int pdg);
+
+  /**
+   * Get the contribution of a track and PDG ID to a hit, creating it if
+   * it doesn't exist yet
+   *
+   * @param[in] hit index of the hit in hits_
+   * @param[in] track_id track ID of the contributor
+   * @param[in] pdg PDG ID of the contributor
+   * @param[out] created set to true if the contribution was just created
+   * @return the contribution
+   */
+  Contrib& findContrib(std::size_t hit, int track_id, int pdg, bool& created);
+
+  /**
+   * Double the size of the table of contributions and re-insert the ones
+   * already in it
+   */
+  void growContribTable();
+
+  /// A slot of the open-addressing table of cells that have been hit
+  struct Slot {
+    /// raw ID of the cell in this slot
+    unsigned int id{0};
+    /// index of the cell's hit in hits_, -1 if the slot is empty
+    int hit{-1};
+  };
+
+  /// first and last contribution to a hit in contribs_
+  struct ContribList {
+    /// index of the first contribution, -1 if there are none
+    int first{-1};
+    /// index of the last contribution, -1 if there are none
+    int last{-1};
+    /// number of contributions
+    unsigned size{0};
+  };
+
+  /// A slot of the open-addressing table of contributions
+  struct ContribSlot {
+    /// index in hits_ of the hit contributed to
+    std::size_t hit{0};
+    /// track ID of the contributor
+    int track_id{0};
+    /// PDG ID of the contributor
+    int pdg{0};
+    /// index of the contribution in contribs_, -1 if the slot is empty
+    int contrib{-1};
+  };
+
+  /// table from cell ID to its hit, the size is always a power of two
+  std::vector<Slot> slots_;
+  /// slots filled during this event
+  std::vector<std::size_t> touched_;
+  /// hits in the order the cells were first hit
+  std::vector<ldmx::SimCalorimeterHit> hits_;
+  /// arena of the contributions to all the hits in this event
+  std::vector<Contrib> contribs_;
+  /// contributions to each hit, parallel to hits_
+  std::vector<ContribList> contrib_lists_;
+  /// table from hit, track and PDG ID to the contribution when compressing
+  std::vector<ContribSlot> contrib_slots_;
+  /// slots of the contribution table filled during this event
+  std::vector<std::size_t> contrib_touched_;
+  /// keep the contributions to each hit
+  bool enable_contribs_;
+  /// merge the contributions of the same track and PDG ID to a hit
+  bool compress_contribs_;
+};
+
+}  // namespace simcore
+
+#endif  // SIMCORE_SDS_ECALHITTABLE_H_
@@ -9,8 +9,10 @@
 #define SIMCORE_ECALSD_H_
 
 // LDMX
+#include "DetDescr/EcalGeometry.h"
 #include "DetDescr/EcalID.h"
 #include "SimCore/Event/SimCalorimeterHit.h"
+#include "SimCore/SDs/EcalHitTable.h"
 #include "SimCore/G4User/TrackingAction.h"
 #include "SimCore/SensitiveDetector.h"
 #include "SimCore/TrackMap.h"
@@ -66,23 +68,61 @@ class EcalSD : public SensitiveDetector {
    */
   G4bool ProcessHits(G4Step* aStep, G4TouchableHistory* ROhist) final override;
 
+  /**
+   * Forget the EcalGeometry of the previous event.
+   *
+   * The conditions may change between events, so the geometry is looked
+   * up again the first time it is used in the new event.
+   *
+   * @param[in] hce hit collections of the event, unused
+   */
+  virtual void Initialize(G4HCofThisEvent* hce) final override;
+
+  /**
+   * Squash the table of hits into the list that will be added to the event.
+   *
+   * @see EcalHitTable::stage
+   */
+  virtual void prepareHits() final override;
+
   /**
    * Add our hits to the event bus.
    */
   virtual void saveHits(framework::Event& event) final override;
 
   /**
-   * Clear the map of hits we have accumulated
+   * Get the number of squashed hits
    */
-  virtual void OnFinishedEvent() final override { hits_.clear(); }
+  virtual std::size_t getNumHits() const final override {
+    return staged_hits_.size();
+  }
+
+  /**
+   * Clear the hits we have accumulated
+   */
+  virtual void OnFinishedEvent() final override {
+    hits_.clear();
+    staged_hits_.clear();
+  }
 
  private:
-  /// map of hits to add to the event (will be squashed)
-  std::map<ldmx::EcalID, ldmx::SimCalorimeterHit> hits_;
-  /// enable hit contribs
-  bool enableHitContribs_;
-  /// compress hit contribs
-  bool compressHitContribs_;
+  /**
+   * Get the EcalGeometry of this event
+   *
+   * Looking a condition up by name costs a map search and a check of its
+   * interval of validity, so it is only done for the first step of an
+   * event that needs it.
+   *
+   * @returns the EcalGeometry
+   */
+  const ldmx::EcalGeometry& getGeometry();
+
+  /// hits in the cells and their contributions in this event
+  EcalHitTable hits_;
+  /// the geometry of the ecal in this event, null until it is used
+  const ldmx::EcalGeometry* geometry_{nullptr};
+  /// squashed list of hits that is added to the event
+  std::vector<ldmx::SimCalorimeterHit> staged_hits_;
 };
 
 }  // namespace simcore
@@ -6,8 +6,10 @@
 /*~~~~~~~~~~~~~~*/
 #include <algorithm>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include "DetDescr/HcalGeometry.h"
 #include "DetDescr/HcalID.h"
 #include "DetDescr/PackedIndex.h"
 #include "SimCore/Event/SimCalorimeterHit.h"
@@ -64,11 +66,20 @@ class HcalSD : public SensitiveDetector {
    *
    * @param copyNumber The copy number of the scintillator volume.
    * @param localPosition The position of the hit (step mid-point).
-   * @param scint The G4Box of the scintillator volume.
+   * @param halfLengths The half-lengths of the scintillator box.
    */
   ldmx::HcalID decodeCopyNumber(const std::uint32_t copyNumber,
                                 const G4ThreeVector& localPosition,
-                                const G4Box* scint);
+                                const G4ThreeVector& halfLengths);
+
+  /**
+   * Forget the HcalGeometry of the previous event.
+   *
+   * The conditions can change from one event to the next.
+   *
+   * @param[in] hce hit collections of the event, unused
+   */
+  virtual void Initialize(G4HCofThisEvent* hce) final override;
 
   /**
    * Create a hit out of the energy deposition deposited during a
@@ -80,6 +91,14 @@ class HcalSD : public SensitiveDetector {
   virtual G4bool ProcessHits(G4Step* aStep,
                              G4TouchableHistory* ROhist) final override;
 
+  /**
+   * Release the indexes of the contributions to merged hits, which are
+   * no longer needed and shouldn't be copied into the event.
+   */
+  virtual void prepareHits() final override {
+    for (auto& hit : hits_) hit.releaseContribIndex();
+  }
+
   /**
    * Add our hits to the event bus and then reset the container
    */
@@ -87,9 +106,55 @@ class HcalSD : public SensitiveDetector {
     event.add(COLLECTION_NAME, hits_);
   }
 
-  virtual void OnFinishedEvent() final override { hits_.clear(); }
+  virtual std::size_t getNumHits() const final override {
+    return hits_.size();
+  }
+
+  virtual void OnFinishedEvent() final override {
+    hits_.clear();
+    merged_.clear();
+  }
 
  private:
+  /**
+   * Get the HcalGeometry of this event
+   *
+   * The geometry is looked up by name the first time a bar needs it in
+   * an event and kept until the next event starts.
+   *
+   * @returns the HcalGeometry
+   */
+  const ldmx::HcalGeometry& getGeometry();
+
+  /**
+   * The steps which are merged into the same hit
+   *
+   * When merging, steps are merged if they are in the same bar and the
+   * same time bin and, if merging per track, were taken by the same track.
+   * Unused fields are left at zero.
+   */
+  struct MergeKey {
+    /// raw HcalID of the bar
+    unsigned int id;
+    /// track ID if merging per track
+    int track_id;
+    /// time bin if a time bin is configured
+    long time_bin;
+    bool operator==(const MergeKey& rhs) const {
+      return id == rhs.id and track_id == rhs.track_id and
+             time_bin == rhs.time_bin;
+    }
+  };
+
+  /// hash of a MergeKey
+  struct MergeKeyHash {
+    std::size_t operator()(const MergeKey& key) const {
+      std::size_t h{std::hash<unsigned int>()(key.id)};
+      h = h * 31 + std::hash<int>()(key.track_id);
+      return h * 31 + std::hash<long>()(key.time_bin);
+    }
+  };
+
   // A list of identifiers used to find out whether or not a given logical
   // volume is one of the Hcal sensitive detector volumes. Any volume that is
   // part of the CalorimeterRegion region and has a name which contains at least
@@ -102,9 +167,24 @@ class HcalSD : public SensitiveDetector {
   // TODO: document!
   double birksc2_;
 
+  /// the geometry of the hcal in this event, null until it is used
+  const ldmx::HcalGeometry* geometry_{nullptr};
+
   // collection of hits to write to event bus
   std::vector<ldmx::SimCalorimeterHit> hits_;
 
+  /// merge the steps in a bar into one hit instead of one hit per step
+  bool merge_steps_;
+
+  /// only merge steps taken by the same track
+  bool merge_per_track_;
+
+  /// width of the time bins steps are merged in [ns], no binning if <= 0
+  double merge_time_bin_;
+
+  /// index in hits_ of the hit each set of merged steps goes into
+  std::unordered_map<MergeKey, std::size_t, MergeKeyHash> merged_;
+
 };  // HcalSD
 
 }  // namespace simcore
@@ -1,6 +1,10 @@
 #ifndef SIMCORE_SCORINGPLANESD_H
 #define SIMCORE_SCORINGPLANESD_H
 
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+
 #include "DetDescr/DetectorID.h"
 #include "SimCore/Event/SimTrackerHit.h"
 #include "SimCore/SensitiveDetector.h"
@@ -51,7 +55,29 @@ class ScoringPlaneSD : public SensitiveDetector {
    */
   virtual void saveHits(framework::Event& event) final override;
 
-  virtual void OnFinishedEvent() final override { hits_.clear(); }
+  virtual std::size_t getNumHits() const final override {
+    return hits_.size();
+  }
+
+  virtual void OnFinishedEvent() final override {
+    hits_.clear();
+    crossed_.clear();
+  }
+
+ private:
+  /**
+   * Get the normal of the plane the step is in
+   *
+   * The normal is the axis along the smallest dimension of the plane,
+   * which is assumed to be a box. The axis is cached in the frame of the
+   * plane by its solid and rotated into global coordinates with the
+   * transform of the placement the step is in, so planes inside mother
+   * volumes placed more than once get the normal of their own placement.
+   *
+   * @param[in] point pre-step point of the step
+   * @return the normal of the plane in global coordinates
+   */
+  G4ThreeVector getNormal(const G4StepPoint* point);
 
  private:
   /// Substring to match to logical volumes
@@ -63,6 +89,27 @@ class ScoringPlaneSD : public SensitiveDetector {
   /// The actual output collection
   std::vector<ldmx::SimTrackerHit> hits_;
 
+  /// Only record particles with these PDG IDs, all if empty
+  std::vector<int> pdg_ids_;
+
+  /// Minimum kinetic energy of a particle entering the step [MeV]
+  double min_energy_;
+
+  /**
+   * Sign of the momentum along the plane normal of the particles to record,
+   * zero records both directions
+   */
+  int direction_;
+
+  /// Only record the first step entering a plane of each track
+  bool first_step_only_;
+
+  /// (track ID, plane copy number) of the crossings already recorded
+  std::unordered_set<std::uint64_t> crossed_;
+
+  /// cached normals of the planes in their own frame by their solid
+  std::unordered_map<const G4VSolid*, G4ThreeVector> normals_;
+
 };  // ScoringPlaneSD
 
 }  // namespace simcore
@@ -51,7 +51,14 @@ class TrackerSD : public SensitiveDetector {
     event.add(collection_name_, hits_);
   }
 
-  virtual void OnFinishedEvent() final override { hits_.clear(); }
+  virtual std::size_t getNumHits() const final override {
+    return hits_.size();
+  }
+
+  virtual void OnFinishedEvent() final override {
+    hits_.clear();
+    last_track_id_ = -1;
+  }
 
  private:
   /// The name of the subsystem we are apart of
@@ -66,6 +73,21 @@ class TrackerSD : public SensitiveDetector {
   /// The detector ID
   ldmx::SubdetectorIDType subDetID_;
 
+  /// Merge consecutive steps of a track in a sensor into one hit
+  bool merge_steps_;
+
+  /// Track ID of the last hit, -1 if there isn't one
+  int last_track_id_{-1};
+
+  /// Raw ID of the sensor of the last hit
+  unsigned int last_id_{0};
+
+  /// Position where the last hit entered the sensor
+  G4ThreeVector last_entry_;
+
+  /// Position where the last step of the last hit ended
+  G4ThreeVector last_exit_;
+
 };  // TrackerID
 
 }  // namespace simcore
@@ -1,6 +1,8 @@
 #ifndef SIMCORE_TRIGSD_H
 #define SIMCORE_TRIGSD_H
 
+#include <unordered_map>
+
 #include "SimCore/Event/SimCalorimeterHit.h"
 #include "SimCore/SensitiveDetector.h"
 
@@ -47,6 +49,14 @@ class TrigScintSD : public SensitiveDetector {
    */
   G4bool ProcessHits(G4Step* step, G4TouchableHistory* history) final override;
 
+  /**
+   * Release the indexes of the contributions to merged hits, which are
+   * no longer needed and shouldn't be copied into the event.
+   */
+  virtual void prepareHits() final override {
+    for (auto& hit : hits_) hit.releaseContribIndex();
+  }
+
   /**
    * Save our hits collection into the event bus and reset it.
    */
@@ -54,7 +64,14 @@ class TrigScintSD : public SensitiveDetector {
     event.add(collection_name_, hits_);
   }
 
-  virtual void OnFinishedEvent() final override { hits_.clear(); }
+  virtual std::size_t getNumHits() const final override {
+    return hits_.size();
+  }
+
+  virtual void OnFinishedEvent() final override {
+    hits_.clear();
+    merged_.clear();
+  }
 
  private:
   /// our collection of hits in this SD
@@ -65,6 +82,10 @@ class TrigScintSD : public SensitiveDetector {
   std::string vol_name_;
   /// the ID number for the module we are gathering hits from
   int module_id_;
+  /// merge the steps in a bar into one hit instead of one hit per step
+  bool merge_steps_;
+  /// index in hits_ of the hit of each bar when merging, by raw ID
+  std::unordered_map<unsigned int, std::size_t> merged_;
 };
 
 }  // namespace simcore
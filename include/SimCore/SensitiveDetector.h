@@ -1,6 +1,11 @@
 #ifndef SIMCORE_SENSITIVEDETECTOR_H_
 #define SIMCORE_SENSITIVEDETECTOR_H_
 
+#include <functional>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+
 #include "Framework/Configure/Parameters.h"
 #include "Framework/RunHeader.h"
 #include "SimCore/ConditionsInterface.h"
@@ -11,8 +16,13 @@
 //------------//
 //   Geant4   //
 //------------//
+#include "G4AffineTransform.hh"
+#include "G4ThreeVector.hh"
 #include "G4VSensitiveDetector.hh"
 
+class G4StepPoint;
+class G4VPhysicalVolume;
+
 namespace simcore {
 
 /**
@@ -67,19 +77,41 @@ class SensitiveDetector : public G4VSensitiveDetector {
   virtual G4bool ProcessHits(G4Step* step,
                              G4TouchableHistory* hist) override = 0;
 
+  /**
+   * End-of-event processing on the collected data (e.g. filtering
+   * or merging hits) before serialization.
+   *
+   * This is called after Geant4 has finished tracking the event but
+   * before saveHits, so it does not have access to the event bus.
+   */
+  virtual void prepareHits() {}
+
   /**
    * We are given the event bus here and we must decide
    * now what to persist into the event.
    *
-   * This function must perform two tasks.
-   * 1. End-of-event processing on the collected data (e.g. filtering
-   *    or merging events) before serilization.
-   * 2. Serialization of collected data with event.add
+   * Any processing of the collected data that does not require the
+   * event bus should be done in prepareHits. This function is then
+   * left with serializing the collected data with event.add
+   *
+   * event.add copies the collection into the object the event bus keeps
+   * for that branch, so the collection here should be kept and cleared
+   * in OnFinishedEvent, holding on to its capacity for the next event.
    *
    * @param[in,out] event event bus to add thing(s) to
    */
   virtual void saveHits(framework::Event& event) = 0;
 
+  /**
+   * Get the number of hits that will be added to the event bus
+   *
+   * This is called after prepareHits and before saveHits and is stored
+   * in the event header as 'num_hits_<name of this SD>'.
+   *
+   * @returns number of hits in the collection for the current event
+   */
+  virtual std::size_t getNumHits() const = 0;
+
   /**
    * This is Geant4's handle to tell us the event is ending
    *
@@ -93,6 +125,31 @@ class SensitiveDetector : public G4VSensitiveDetector {
    */
   virtual void EndOfEvent(G4HCofThisEvent*) override {}
 
+  /**
+   * This is Geant4's handle to tell us a new event is starting
+   *
+   * Like EndOfEvent, the hit collections are of no use to us. We reset
+   * the energy dropped by the readout cuts here since it has to be reset
+   * whether or not the previous event was serialized. Detectors that
+   * override this need to call it.
+   */
+  virtual void Initialize(G4HCofThisEvent*) override { dropped_edep_ = 0.; }
+
+  /**
+   * Does this detector apply readout cuts to its steps?
+   *
+   * If it does, the energy dropped by the cuts is stored in the event
+   * header as 'dropped_edep_<name of this SD>'.
+   */
+  bool hasReadoutCuts() const { return has_readout_cuts_; }
+
+  /**
+   * Get the energy of the steps dropped by the readout cuts in this event
+   *
+   * @returns dropped energy [MeV]
+   */
+  double getDroppedEnergy() const { return dropped_edep_; }
+
   /**
    * Cleanup SD and prepare a new-event state.
    */
@@ -106,6 +163,95 @@ class SensitiveDetector : public G4VSensitiveDetector {
   // virtual void RecordConfig(ldmx::RunHeader& header) const = 0;
 
  protected:
+  /**
+   * Information about a sensitive volume
+   *
+   * None of this changes while the geometry is closed, so it is worked
+   * out from the touchable the first time the volume is stepped in and
+   * looked up after that.
+   */
+  struct VolumeInfo {
+    /// copy number of the volume at the depth the detector reads it from
+    int copy_number{0};
+    /// half-lengths of the solid if it is a box, zero otherwise
+    G4ThreeVector half_lengths;
+    /// density of the material of the volume
+    double density{0.};
+    /// transform from global coordinates to the coordinates of the volume
+    G4AffineTransform to_local;
+    /// global position of the origin of the volume
+    G4ThreeVector center;
+  };
+
+  /**
+   * Get the information about the volume a step point is in
+   *
+   * The volumes are identified by their physical volume and replica
+   * number, so a physical volume is assumed to be placed only once in
+   * the detector. This holds for the sensitive volumes of the LDMX
+   * detectors, where each sensor, bar and layer is its own placement.
+   *
+   * @throws Exception the first time the volume is stepped in if it is
+   * above the input depth
+   *
+   * @param[in] point the step point to get the volume from
+   * @param[in] copy_depth level of the geometry tree to read the copy
+   * number from, 0 is the world volume
+   * @returns information about the volume
+   */
+  const VolumeInfo& getVolumeInfo(const G4StepPoint* point, int copy_depth);
+
+  /**
+   * Configure the readout time window of this detector
+   *
+   * The window is read from the 'min_time' and 'max_time' [ns]
+   * parameters and is open at both ends by default. This alone does not
+   * count as a readout cut, so no dropped energy is reported.
+   *
+   * @param[in] parameters python configuration parameters
+   */
+  void configureReadoutWindow(const framework::config::Parameters& parameters);
+
+  /**
+   * Configure the readout cuts of this detector
+   *
+   * The cuts are the readout window (see configureReadoutWindow) and the
+   * minimum energy 'min_edep' [MeV] of a step.
+   * The window is open at both ends and there is no minimum energy by
+   * default. The detector only counts as having readout cuts if one of
+   * them is set.
+   *
+   * @param[in] parameters python configuration parameters
+   */
+  void configureReadoutCuts(const framework::config::Parameters& parameters);
+
+  /**
+   * Check if a step is within the readout time window
+   *
+   * Unlike passesReadoutCuts, this doesn't count the energy of the steps
+   * outside of the window.
+   *
+   * @param[in] step the step to check
+   * @returns true if the global time of the track is within the window
+   */
+  bool inReadoutWindow(const G4Step* step) const;
+
+  /**
+   * Check if a step passes the readout cuts
+   *
+   * The global time of the track has to be within the readout window and
+   * the energy of the step has to be at least the minimum. Geantino steps
+   * are exempt from the minimum energy so that geometry scans still make
+   * hits. This should be called before anything is done with the step so
+   * that cut steps cost as little as possible. The energy of cut steps is
+   * added to the dropped energy of the event.
+   *
+   * @param[in] step the step to check
+   * @param[in] edep the energy the step would add to a hit [MeV]
+   * @returns true if the step should make a hit
+   */
+  bool passesReadoutCuts(const G4Step* step, double edep);
+
   /**
    * Get a condition object from the conditions interface
    *
@@ -140,9 +286,44 @@ class SensitiveDetector : public G4VSensitiveDetector {
   }
 
  private:
+  /// physical volume and replica number of a sensitive volume
+  using VolumeKey = std::pair<const G4VPhysicalVolume*, int>;
+
+  /// hash of a sensitive volume for the cache
+  struct VolumeKeyHash {
+    std::size_t operator()(const VolumeKey& key) const {
+      return std::hash<const G4VPhysicalVolume*>()(key.first) ^
+             static_cast<std::size_t>(key.second) * 0x9e3779b97f4a7c15ull;
+    }
+  };
+
   /// Handle to our interface to conditions objects
   simcore::ConditionsInterface& conditions_interface_;
 
+  /// cached sensitive volumes
+  std::unordered_map<VolumeKey, VolumeInfo, VolumeKeyHash> volume_cache_;
+
+  /// the volume looked up last, steps often stay in the same volume
+  VolumeKey last_volume_{nullptr, 0};
+
+  /// the information about the volume looked up last
+  const VolumeInfo* last_volume_info_{nullptr};
+
+  /// is any of the readout cuts set
+  bool has_readout_cuts_{false};
+
+  /// start of the readout window [ns]
+  double min_time_{-std::numeric_limits<double>::infinity()};
+
+  /// end of the readout window [ns]
+  double max_time_{std::numeric_limits<double>::infinity()};
+
+  /// minimum energy of a step [MeV]
+  double min_edep_{0.};
+
+  /// energy of the steps cut in this event [MeV]
+  double dropped_edep_{0.};
+
 };  // SensitiveDetector
 }  // namespace simcore
 
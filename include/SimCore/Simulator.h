@@ -106,16 +106,6 @@ class Simulator : public SimulatorBase {
   /// Callback called once processing is complete.
   void onProcessEnd() final override;
 
- private:
-  /**
-   * Set the seeds to be used by the Geant4 random engine.
-   *
-   * @param[in] seeds A vector of seeds to pass to the G4 random
-   *      engine.  The vector must contain at least 2 seeds otherwise
-   *      an exception is thrown.
-   */
-  void setSeeds(std::vector<int> seeds);
-
  private:
   /// Number of events started
   int numEventsBegan_{0};
@@ -125,6 +115,9 @@ class Simulator : public SimulatorBase {
 
   /// the run number (for accessing the run header in onFileClose
   int run_{-1};
+
+  /// the seeds for this run, used to derive compact per-event seeds
+  std::vector<int> runSeeds_;
 };
 }  // namespace simcore
 
@@ -59,6 +59,12 @@ class SimulatorBase : public framework::Producer {
 
   /// Vebosity for the simulation
   int verbosity_{1};
+
+  /**
+   * Seed each event from a small key derived from the run seeds and the
+   * run and event numbers instead of storing the full engine state
+   */
+  bool compactEventSeeds_{false};
   /// The parameters used to configure the simulation
   framework::config::Parameters parameters_;
 
@@ -74,6 +80,17 @@ class SimulatorBase : public framework::Producer {
    */
   virtual void updateEventHeader(ldmx::EventHeader& eventHeader) const;
 
+  /*
+   * Prepare the output of the current event and terminate it in Geant4
+   *
+   * The ancestry of the particles to save is traced and the sensitive
+   * detectors prepare their hits before Geant4 terminates the event.
+   *
+   * This needs to be called after updateEventHeader and before
+   * saveTracks and saveSDHits.
+   */
+  void terminateEvent();
+
   /*
    * Save all tracks from the event that are marked for saving
    */
@@ -86,6 +103,15 @@ class SimulatorBase : public framework::Producer {
 
   virtual void produce(framework::Event& event) override = 0;
 
+  /**
+   * Set the seeds to be used by the Geant4 random engine.
+   *
+   * @param[in] seeds A vector of seeds to pass to the G4 random
+   *      engine.  The vector must contain at least 2 seeds otherwise
+   *      an exception is thrown.
+   */
+  void setSeeds(std::vector<int> seeds);
+
  private:
   /*
    * Set up logging for Geant4 during initialization
@@ -0,0 +1,138 @@
+/**
+ * @file StartupTimers.h
+ * @brief Class recording how long the phases of the simulation startup take
+ */
+
+#ifndef SIMCORE_STARTUPTIMERS_H_
+#define SIMCORE_STARTUPTIMERS_H_
+
+/*~~~~~~~~~~~~~~~~*/
+/*   C++ StdLib   */
+/*~~~~~~~~~~~~~~~~*/
+#include <chrono>
+#include <ctime>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace ldmx {
+class RunHeader;
+}
+
+namespace simcore {
+
+/**
+ * @class StartupTimers
+ * @brief Global store of the wall time, CPU time and RSS change of each
+ * named phase of the simulation startup
+ *
+ * A phase is timed for as long as the Phase returned by time() is in
+ * scope. Phases can be nested (e.g. the loading of a field map happens
+ * while the geometry is built), so the phases do not add up to the total
+ * startup time. Timing the same phase more than once adds to its totals.
+ */
+class StartupTimers {
+ public:
+  /**
+   * @class Phase
+   * @brief Times a single phase from its construction until its destruction
+   */
+  class Phase {
+   public:
+    /**
+     * Start timing the phase
+     *
+     * @param[in] name name of the phase
+     */
+    Phase(const std::string& name);
+
+    /// Stop timing the phase and record it in the StartupTimers
+    ~Phase();
+
+    // phases are timed once, so they can't be copied
+    Phase(const Phase&) = delete;
+    Phase& operator=(const Phase&) = delete;
+
+   private:
+    /// name of the phase
+    std::string name_;
+    /// wall time at the start of the phase
+    std::chrono::steady_clock::time_point wall_start_;
+    /// CPU time at the start of the phase
+    std::clock_t cpu_start_;
+    /// RSS at the start of the phase [MB]
+    double rss_start_;
+  };
+
+  /**
+   * Get the global instance of the startup timers.
+   * @return The startup timers.
+   */
+  static StartupTimers& getInstance();
+
+  /**
+   * Time a phase of the startup until the returned Phase goes out of scope
+   *
+   * @param[in] name name of the phase
+   * @return the Phase timing it
+   */
+  static Phase time(const std::string& name) { return Phase(name); }
+
+  /**
+   * Add the times and RSS change of a phase
+   *
+   * @param[in] name name of the phase
+   * @param[in] wall wall time of the phase [s]
+   * @param[in] cpu CPU time of the phase [s]
+   * @param[in] rss change in the RSS during the phase [MB]
+   */
+  void record(const std::string& name, double wall, double cpu, double rss);
+
+  /**
+   * Write the recorded phases into the run header
+   *
+   * Each phase is written as three float parameters:
+   * 'Startup <phase> Wall Time [s]', 'Startup <phase> CPU Time [s]' and
+   * 'Startup <phase> RSS Delta [MB]'.
+   *
+   * @param[in,out] header RunHeader to write the phases into
+   */
+  void recordConfig(ldmx::RunHeader& header) const;
+
+  /**
+   * Print the recorded phases in the order they finished
+   *
+   * @param[in] out stream to print to
+   */
+  void print(std::ostream& out) const;
+
+  /**
+   * Get the current resident set size of this process
+   *
+   * @return the RSS [MB], zero if it can't be determined
+   */
+  static double currentRSS();
+
+  // Delete the following methods to make sure they are inaccesible.
+  StartupTimers(StartupTimers const&) = delete;
+  void operator=(StartupTimers const&) = delete;
+
+ private:
+  /// Default constructor
+  StartupTimers() = default;
+
+  /// Times recorded for a single phase
+  struct Record {
+    std::string name;
+    double wall;
+    double cpu;
+    double rss;
+  };
+
+  /// the recorded phases in the order they finished
+  std::vector<Record> records_;
+};
+
+}  // namespace simcore
+
+#endif  // SIMCORE_STARTUPTIMERS_H_
@@ -2,7 +2,8 @@
 #define SIMCORE_TRACKMAP_H_
 
 // STL
-#include <unordered_map>
+#include <map>
+#include <vector>
 
 // Geant4
 #include "G4Event.hh"
@@ -24,6 +25,11 @@ namespace simcore {
  * in an event. This allows the particles that are chosen to
  * be saved (via the TrackMap::save method) to have their
  * parent and children faithfully recorded in the output file.
+ *
+ * Geant4 track IDs are dense and sequential within an event, so the
+ * ancestry is stored in flat arrays indexed by track ID. The buffers
+ * are cleared but not deallocated between events, so after the first
+ * few events no allocations are needed to track an event.
  */
 class TrackMap {
  public:
@@ -38,7 +44,8 @@ class TrackMap {
    * into the track map.
    */
   inline bool contains(const G4Track* track) const {
-    return ancestry_.find(track->GetTrackID()) != ancestry_.end();
+    std::size_t id = track->GetTrackID();
+    return id < ancestry_.size() and ancestry_[id].parent >= 0;
   }
 
   /**
@@ -48,6 +55,9 @@ class TrackMap {
    * If this track ID does not have such a trajectory, then the
    * track ID of the primary in its parentage is returned.
    *
+   * The incident is found when the track is inserted, so this is
+   * just a look up.
+   *
    * @param trackID The track ID to search its parentage for the incident
    */
   int findIncident(int trackID) const;
@@ -77,6 +87,10 @@ class TrackMap {
    * This should be done at the end of the event before writing
    * the particle map to the event bus and involves looping
    * through the particles that will be saved.
+   *
+   * The descendents of all tracks are first built in compressed
+   * sparse row form, with the children of each parent kept in the
+   * order they were inserted.
    */
   void traceAncestry();
 
@@ -86,6 +100,8 @@ class TrackMap {
    * This should be called at the **beginning** of an event.
    * The maps need to persist through the end of the event so
    * that they are available to be written to the output file.
+   *
+   * The capacity of the ancestry buffers is kept for the next event.
    */
   void clear();
 
@@ -98,35 +114,57 @@ class TrackMap {
   /**
    * Was the input track generated inside the calorimeter region?
    *
-   * We rely on the fact that the calorimeter region is named
-   *  'CalorimeterRegion'
-   * and no other region names contain the string 'Calorimeter'
+   * This is resolved once per region when the region is created
+   * from the detector description.
+   *
+   * @see UserRegionInformation::isCalorimeter
    */
   bool isInCalorimeterRegion(const G4Track* track) const;
 
  private:
+  /// ancestry of a single track
+  struct Ancestry {
+    /// track ID of the parent, -1 if this track hasn't been inserted
+    int parent{-1};
+    /**
+     * track ID of the nearest ancestor (including this track) which
+     * originated outside of the calorimeter region or is a primary
+     */
+    int incident{-1};
+  };
+
   /**
-   * ancestry map of particles in event (child -> parent)
+   * ancestry of particles in event (child -> parent), indexed by track ID
    *
    * Primary particles are given a "parent" ID of 0 to reflect
    * that they don't have a parent. This is the default in Geant4
    * and we assume that holds here.
    *
-   * This is helpful for the findIncident method which looks
-   * up through a track's history to find the first ancestor
-   * which originated outside of the calorimeter region.
-   *
-   * The key value is a pair where the first entry
-   * is the parent track ID and the second entry is
-   * whether **the child track** is in the calorimeter region.
+   * The incident of each track is found when it is inserted. A track
+   * which originated outside of the calorimeter region (or is a
+   * primary) is its own incident, otherwise it has the same incident
+   * as its parent. Parents are always inserted before their children,
+   * so this replaces walking up through the track's history for every
+   * calorimeter hit.
    *
    * @see isInCalorimeterRegion for how we check if a track
    * originated in the calorimeter region.
    */
-  std::unordered_map<int, std::pair<int, bool>> ancestry_;
+  std::vector<Ancestry> ancestry_;
+
+  /// track IDs in the order they were inserted
+  std::vector<int> inserted_;
+
+  /**
+   * offsets into descendents_ for each parent track ID
+   *
+   * The children of parent i are descendents_[offsets_[i]] to
+   * descendents_[offsets_[i+1]-1]. Only filled by traceAncestry.
+   */
+  std::vector<std::size_t> offsets_;
 
-  /// descendents map of particles in event (parent -> children)
-  std::unordered_map<int, std::vector<int>> descendents_;
+  /// descendents of particles in event (parent -> children)
+  std::vector<int> descendents_;
 
   /// map of SimParticles that will be stored
   std::map<int, ldmx::SimParticle> particle_map_;
@@ -140,6 +140,18 @@ class UserAction {
    */
   virtual void NewStage(){};
 
+  /**
+   * Method called at the beginning of a new stage, after NewStage, to
+   * decide if the event should be aborted before the tracks waiting for
+   * this stage are processed.
+   *
+   * TYPE::STACKING
+   *
+   * @param stages_completed number of stages completed in this event
+   * @return true if the event should be aborted
+   */
+  virtual bool abortAtNewStage(int) { return false; };
+
   /**
    * Method called at the beginning of a new event
    *
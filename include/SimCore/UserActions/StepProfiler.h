@@ -0,0 +1,198 @@
+#ifndef SIMCORE_USERACTIONS_STEPPROFILER_H_
+#define SIMCORE_USERACTIONS_STEPPROFILER_H_
+
+/*~~~~~~~~~~~~~~~~*/
+/*   C++ StdLib   */
+/*~~~~~~~~~~~~~~~~*/
+#include <array>
+#include <chrono>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*~~~~~~~~~~~~*/
+/*   Geant4   */
+/*~~~~~~~~~~~~*/
+#include "G4VSDFilter.hh"
+
+/*~~~~~~~~~~~~~*/
+/*   SimCore   */
+/*~~~~~~~~~~~~~*/
+#include "SimCore/UserAction.h"
+
+class G4LogicalVolume;
+class G4Region;
+class G4VProcess;
+
+namespace simcore {
+
+class SensitiveDetector;
+
+namespace useractions {
+
+/**
+ * Profile where the simulation spends its steps and its time
+ *
+ * Every sample_period steps, the time taken by a step is measured and
+ * attributed to the logical volume and region it was taken in, the PDG
+ * of the particle, the process that limited it and the decade of its
+ * kinetic energy. The number of steps along each of these axes is
+ * estimated from the sampled steps, so the overhead is two clock reads
+ * and a few hash lookups every sample_period steps.
+ *
+ * The time spent in ProcessHits of each of our sensitive detectors is
+ * measured on the same sampled steps by attaching a filter to the SDs
+ * which don't have one already. Geant4 calls the filter right before
+ * ProcessHits and calls the stepping action right after it.
+ *
+ * A table of each axis, sorted by the time spent, is printed at the end
+ * of the run.
+ */
+class StepProfiler : public UserAction {
+ public:
+  /**
+   * Constructor
+   *
+   * @param[in] name the name of this action
+   * @param[in] parameters the parameters used to configure this action
+   */
+  StepProfiler(const std::string& name,
+               framework::config::Parameters& parameters);
+
+  /// Destructor
+  virtual ~StepProfiler() = default;
+
+  /**
+   * Attach the timing filters to the sensitive detectors.
+   *
+   * @param[in] run the current run
+   */
+  void BeginOfRunAction(const G4Run* run) final override;
+
+  /**
+   * Detach the timing filters and print the tables.
+   *
+   * @param[in] run the current run
+   */
+  void EndOfRunAction(const G4Run* run) final override;
+
+  /**
+   * Sample the step if it is time to
+   *
+   * @param[in] step the step that was just taken
+   */
+  void stepping(const G4Step* step) final override;
+
+  /// Retrieve the types of actions this class defines
+  std::vector<TYPE> getTypes() final override {
+    return {TYPE::RUN, TYPE::STEPPING};
+  }
+
+ private:
+  /**
+   * @class SDTimer
+   * @brief Filter which marks the start of ProcessHits in a sensitive
+   * detector on the sampled steps
+   *
+   * It accepts every step, so it doesn't change which steps the
+   * sensitive detector processes.
+   */
+  class SDTimer : public G4VSDFilter {
+   public:
+    /**
+     * Constructor
+     *
+     * @param[in] profiler the profiler to report to
+     * @param[in] sd the sensitive detector this filter is attached to
+     */
+    SDTimer(StepProfiler& profiler, SensitiveDetector* sd);
+
+    /// Mark the start of ProcessHits if this step is sampled
+    G4bool Accept(const G4Step*) const final override;
+
+   private:
+    /// the profiler to report to
+    StepProfiler& profiler_;
+    /// the sensitive detector this filter is attached to
+    SensitiveDetector* sd_;
+  };
+
+  /// The steps and time attributed to one entry along an axis
+  struct Stat {
+    /// number of sampled steps
+    long samples{0};
+    /// total time of the sampled steps [s]
+    double time{0.};
+  };
+
+  /// number of energy bins: below 1 keV, one per decade and above 10 TeV
+  static constexpr std::size_t NUM_ENERGY_BINS{12};
+
+  /**
+   * Get the energy bin of a kinetic energy
+   *
+   * @param[in] energy kinetic energy [MeV]
+   * @return index of the energy bin
+   */
+  static std::size_t energyBin(double energy);
+
+  /**
+   * Print the table of one axis, sorted by time
+   *
+   * @param[in] axis name of the axis
+   * @param[in] rows name and stats of each entry along the axis
+   */
+  void printTable(const std::string& axis,
+                  std::vector<std::pair<std::string, Stat>> rows) const;
+
+ private:
+  /// Sample one out of this many steps
+  int sample_period_;
+
+  /// Maximum number of rows to print for each axis
+  int max_rows_;
+
+  /// Number of steps until the next sampled step
+  int countdown_;
+
+  /// Is the step in progress being sampled?
+  bool sampling_{false};
+
+  /// Track ID of the step before the sampled step
+  int sampled_track_id_{-1};
+
+  /// Time at the end of the step before the sampled step
+  std::chrono::steady_clock::time_point step_start_;
+
+  /// SD processing the sampled step, if any
+  SensitiveDetector* sd_{nullptr};
+
+  /// Time at the start of ProcessHits of the sampled step
+  std::chrono::steady_clock::time_point sd_start_;
+
+  /// Filters attached by us which need to be detached at the end of the run
+  std::vector<SensitiveDetector*> timed_sds_;
+
+  /// Stats by logical volume
+  std::unordered_map<const G4LogicalVolume*, Stat> by_volume_;
+
+  /// Stats by region
+  std::unordered_map<const G4Region*, Stat> by_region_;
+
+  /// Stats by particle PDG
+  std::unordered_map<int, Stat> by_pdg_;
+
+  /// Stats by step-limiting process
+  std::unordered_map<const G4VProcess*, Stat> by_process_;
+
+  /// Stats by kinetic energy bin
+  std::array<Stat, NUM_ENERGY_BINS> by_energy_;
+
+  /// Stats by sensitive detector, only the time in ProcessHits
+  std::unordered_map<const SensitiveDetector*, Stat> by_sd_;
+};  // StepProfiler
+
+}  // namespace useractions
+}  // namespace simcore
+
+#endif  // SIMCORE_USERACTIONS_STEPPROFILER_H_
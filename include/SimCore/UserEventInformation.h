@@ -1,6 +1,9 @@
 #ifndef SIMCORE_USEREVENTINFORMATION_H
 #define SIMCORE_USEREVENTINFORMATION_H
 
+#include <chrono>
+#include <ctime>
+
 #include "G4VUserEventInformation.hh"
 namespace simcore {
 
@@ -117,6 +120,48 @@ class UserEventInformation : public G4VUserEventInformation {
    */
   bool wasLastStepEN() const { return last_step_en_; }
 
+  /// Count a step taken in this event
+  void incStepCount() { num_steps_++; }
+
+  /// @return The number of steps taken in this event
+  int getStepCount() const { return num_steps_; }
+
+  /// Count a track created in this event
+  void incTracksCreated() { num_tracks_created_++; }
+
+  /// @return The number of tracks created in this event
+  int getTracksCreated() const { return num_tracks_created_; }
+
+  /// Count a track saved into the output particle map
+  void incTracksSaved() { num_tracks_saved_++; }
+
+  /// @return The number of tracks saved into the output particle map
+  int getTracksSaved() const { return num_tracks_saved_; }
+
+  /**
+   * Update the largest number of tracks waiting in the stacks
+   *
+   * @param[in] size current number of tracks in the stacks
+   */
+  void updatePeakStackSize(int size) {
+    if (size > peak_stack_size_) peak_stack_size_ = size;
+  }
+
+  /// @return The largest number of tracks waiting in the stacks
+  int getPeakStackSize() const { return peak_stack_size_; }
+
+  /// Start timing the processing of this event
+  void startTimers();
+
+  /// Stop timing the processing of this event
+  void stopTimers();
+
+  /// @return The CPU time this thread spent processing this event [s]
+  double getCPUTime() const { return cpu_time_; }
+
+  /// @return The wall time spent processing this event [s]
+  double getWallTime() const { return wall_time_; }
+
  private:
   /// Total number of brem candidates in the event
   int bremCandidateCount_{0};
@@ -165,6 +210,30 @@ class UserEventInformation : public G4VUserEventInformation {
    * dark brem did not occur within the event in question.
    */
   double db_material_z_{-1.};
+
+  /// Number of steps taken in this event
+  int num_steps_{0};
+
+  /// Number of tracks created in this event
+  int num_tracks_created_{0};
+
+  /// Number of tracks saved into the output particle map
+  int num_tracks_saved_{0};
+
+  /// Largest number of tracks waiting in the stacks
+  int peak_stack_size_{0};
+
+  /// wall time when the processing of this event started
+  std::chrono::steady_clock::time_point wall_start_;
+
+  /// CPU time of this thread when the processing of this event started
+  timespec cpu_start_{0, 0};
+
+  /// CPU time this thread spent processing this event [s]
+  double cpu_time_{0.};
+
+  /// Wall time spent processing this event [s]
+  double wall_time_{0.};
 };
 }  // namespace simcore
 
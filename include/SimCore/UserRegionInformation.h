@@ -8,6 +8,7 @@
 #define SIMCORE_USERREGIONINFORMATION_H_
 
 // Geant4
+#include "G4Track.hh"
 #include "G4VUserRegionInformation.hh"
 
 namespace simcore {
@@ -21,19 +22,52 @@ namespace simcore {
  * whether secondary particles should be stored.  This flag is used
  * in the UserTrackingAction to determine whether or not a trajectory
  * is created for a track created in the region.
+ *
+ * The properties of a region are resolved once when the region is
+ * created from the detector description, so that looking them up for
+ * a track is a couple of pointer dereferences without any string
+ * handling.
  */
 class UserRegionInformation : public G4VUserRegionInformation {
  public:
-  UserRegionInformation(bool storeSecondaries);
+  /**
+   * Constructor
+   *
+   * @param[in] storeSecondaries should the secondaries created in this
+   * region be stored
+   * @param[in] isCalorimeter is this region part of the calorimeter
+   */
+  UserRegionInformation(bool storeSecondaries, bool isCalorimeter);
 
   virtual ~UserRegionInformation() = default;
 
   void Print() const;
 
-  bool getStoreSecondaries() const;
+  bool getStoreSecondaries() const { return storeSecondaries_; }
+
+  /**
+   * Is this region part of the calorimeter?
+   *
+   * Tracks created in the calorimeter are not incident on it, so this is
+   * used to find the incident particle of calorimeter hits.
+   */
+  bool isCalorimeter() const { return isCalorimeter_; }
+
+  /**
+   * Get the information of the region the input track was created in
+   *
+   * @param[in] track track to get the region information for
+   * @return the region information, nullptr if the region doesn't have any
+   */
+  static const UserRegionInformation* get(const G4Track* track) {
+    return static_cast<const UserRegionInformation*>(
+        track->GetLogicalVolumeAtVertex()->GetRegion()->GetUserInformation());
+  }
 
  private:
   bool storeSecondaries_;
+
+  bool isCalorimeter_;
 };
 
 }  // namespace simcore
@@ -1,6 +1,7 @@
 #ifndef SIMCORE_USERTRACKINFORMATION_H
 #define SIMCORE_USERTRACKINFORMATION_H
 
+#include "G4LogicalVolume.hh"
 #include "G4ThreeVector.hh"
 #include "G4Track.hh"
 #include "G4VUserTrackInformation.hh"
@@ -12,13 +13,33 @@ namespace simcore {
  *
  * This is helpful for keeping track of information we care about
  * that Geant4 doesn't persist by default.
+ *
+ * Every track gets one of these, so they are allocated from a per-thread
+ * G4Allocator instead of the heap, like Geant4 does for its tracks.
+ * Geant4 deletes the information along with its track, which gives its
+ * storage back to the allocator.
  */
-class UserTrackInformation : public G4VUserTrackInformation {
+class UserTrackInformation final : public G4VUserTrackInformation {
  public:
   /// Constructor
   UserTrackInformation() = default;
 
   virtual ~UserTrackInformation() = default;
+
+  /**
+   * Allocate the storage for a new track information
+   *
+   * @return pointer to the storage
+   */
+  static void* operator new(std::size_t);
+
+  /**
+   * Give the storage of a deleted track information back
+   *
+   * @param[in] ptr pointer to the storage
+   */
+  static void operator delete(void* ptr);
+
   /**
    * get
    *
@@ -110,8 +131,13 @@ class UserTrackInformation : public G4VUserTrackInformation {
 
   /**
    * Get the name of the volume that this track was created in.
+   *
+   * The name is only copied out of the volume when it is asked for.
+   * It is empty if the track information hasn't been initialized.
    */
-  std::string getVertexVolume() const { return vertexVolume_; }
+  std::string getVertexVolume() const {
+    return vertexVolume_ ? vertexVolume_->GetName() : "";
+  }
 
   /**
    * Get the global time at which this track was created.
@@ -138,7 +164,7 @@ class UserTrackInformation : public G4VUserTrackInformation {
   bool isPNGamma_{false};
 
   /// Volume the track was created in.
-  std::string vertexVolume_{""};
+  const G4LogicalVolume* vertexVolume_{nullptr};
 
   /// Global Time of Creation
   double vertex_time_{0.};
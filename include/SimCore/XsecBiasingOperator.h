@@ -154,12 +154,37 @@ class XsecBiasingOperator : public G4VBiasingOperator {
    */
   bool processIsBiased(std::string process);
 
+  /**
+   * Find the biased process with the given name.
+   *
+   * @param process Name of the process of interest
+   * @return the process wrapped by the biasing wrapper, nullptr if the
+   * process is not being biased
+   */
+  const G4VProcess* findBiasedProcess(const std::string& process) const;
+
+  /**
+   * Check if the calling process is the process we are biasing.
+   *
+   * The process is found when the run starts, so this is a pointer
+   * comparison instead of comparing process names on every call.
+   *
+   * @param callingProcess handle to process asking if it should be biased
+   * @return true if the calling process wraps the process to bias
+   */
+  bool isProcessToBias(const G4BiasingProcessInterface* callingProcess) const {
+    return callingProcess->GetWrappedProcess() == processToBias_;
+  }
+
   /** Cross-section biasing operation. */
   G4BOptnChangeCrossSection* xsecOperation_{nullptr};
 
   /** Process manager associated with the particle of interest. */
   G4ProcessManager* processManager_{nullptr};
 
+  /** Process whose cross-section is biased, found at the start of the run. */
+  const G4VProcess* processToBias_{nullptr};
+
   /**
    * Do *not* propose any biasing on final states.
    */
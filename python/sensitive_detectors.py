@@ -13,6 +13,23 @@ class ScoringPlaneSD(simcfg.SensitiveDetector) :
     subsystem : str
         Name of subsystem to store scoring plane hits for
         Names must match what is in gdml for sp_<subsystem>
+    pdg_ids : list[int], optional
+        Only record particles with these PDG IDs, all particles if empty
+    min_energy : float, optional
+        Only record particles entering the step with at least this
+        kinetic energy [MeV]
+    direction : int, optional
+        Only record particles whose momentum along the plane normal (the
+        axis along the thinnest dimension of the plane) has this sign,
+        both directions if zero
+    min_time : float, optional
+        Only record steps at or after this global time [ns], no minimum by
+        default since steps upstream of the target have negative times
+    max_time : float, optional
+        Only record steps at or before this global time [ns], no maximum by
+        default
+    first_step_only : bool, optional
+        Only record the first step of each track entering each plane
     """
     def __init__(self,subsystem) :
         super().__init__(f'{subsystem}_sp','simcore::ScoringPlaneSD','SimCore_SDs')
@@ -21,6 +38,12 @@ class ScoringPlaneSD(simcfg.SensitiveDetector) :
         #  that function changes all characters after the first one to lowercase
         self.collection_name = f'{subsystem[0].upper()+subsystem[1:]}ScoringPlaneHits'
         self.match_substr = f'sp_{subsystem}' #depends on gdml
+        self.pdg_ids = []
+        self.min_energy = 0.
+        self.direction = 0
+        self.min_time = float('-inf')
+        self.max_time = float('inf')
+        self.first_step_only = False
 
     def ecal() :
         return ScoringPlaneSD('ecal')
@@ -51,12 +74,18 @@ class TrackerSD(simcfg.SensitiveDetector) :
         Recoil or Tagger
     subdet_id : int
         ID number for the subsystem
+    merge_steps : bool, optional
+        Merge consecutive steps of the same track in the same sensor into a
+        single hit with the summed edep, the midpoint between where the track
+        entered the sensor and where its last step ended, and the total path
+        length.
     """
     def __init__(self,subsystem,subdet_id) :
         super().__init__(f'{subsystem}_TrackerSD','simcore::TrackerSD','SimCore_SDs')
 
         self.subsystem = subsystem
         self.subdet_id = subdet_id
+        self.merge_steps = False
 
         self.collection_name = f'{subsystem}SimHits'
 
@@ -82,6 +111,26 @@ class HcalSD(simcfg.SensitiveDetector) :
 
         The current defaults match the mainline LDMX Hcal and
         prototype Hcal (scint_box) scintillator geometries.
+    merge_steps : bool, optional
+        Merge the steps in a bar into a single hit with one contributor per
+        track and PDG instead of creating one hit per step.
+    merge_per_track : bool, optional
+        When merging, only merge the steps taken by the same track so that
+        each hit is the segment of a track through a bar.
+    merge_time_bin : float, optional
+        When merging, only merge the steps within the same time bin of this
+        width [ns]. Zero or negative disables the time binning.
+    min_time : float, optional
+        Start of the readout window [ns]. Steps whose track's global time is
+        earlier are dropped. Open by default since the tracks upstream of the
+        target have negative times.
+    max_time : float, optional
+        End of the readout window [ns]. Steps whose track's global time is
+        later are dropped. Open by default.
+    min_edep : float, optional
+        Minimum energy [MeV] deposited by a step for it to make a hit.
+        Geantino steps are not held to it. The energy of dropped steps is stored in the event header as
+        dropped_edep_<name of the SD>.
 
     """
     def __init__(self, gdml_identifiers = ['scintYVolume', 'scintXVolume',
@@ -92,11 +141,17 @@ class HcalSD(simcfg.SensitiveDetector) :
                                            'scint_box']) :
         super().__init__('hcal_sd', 'simcore::HcalSD','SimCore_SDs')
         self.gdml_identifiers = gdml_identifiers
+        self.merge_steps = False
+        self.merge_per_track = False
+        self.merge_time_bin = 0.
+        self.min_time = float('-inf')
+        self.max_time = float('inf')
+        self.min_edep = 0.
 
 class EcalSD(simcfg.SensitiveDetector) :
     """SD for the ECal
 
-    The two configurable parameters are inherited from a legacy method of
+    The first two parameters are inherited from a legacy method of
     merging simulated hit contribs. We have plans to update this hit merging
     in the future.
 
@@ -106,11 +161,25 @@ class EcalSD(simcfg.SensitiveDetector) :
         Should the simulation save contributions to Ecal sim hits?
     compressHitContribs : bool, optional
         Should the simulation compress contributions to Ecal sim hits by PDG ID?
+    min_time : float, optional
+        Start of the readout window [ns]. Steps whose track's global time is
+        earlier are dropped. Open by default since the tracks upstream of the
+        target have negative times.
+    max_time : float, optional
+        End of the readout window [ns]. Steps whose track's global time is
+        later are dropped. Open by default.
+    min_edep : float, optional
+        Minimum energy [MeV] deposited by a step for it to make a hit.
+        Geantino steps are not held to it. The energy of dropped steps is stored in the event header as
+        dropped_edep_<name of the SD>.
     """
     def __init__(self) :
         super().__init__('ecal_sd', 'simcore::EcalSD','SimCore_SDs')
         self.enableHitContribs = True
         self.compressHitContribs = True
+        self.min_time = float('-inf')
+        self.max_time = float('inf')
+        self.min_edep = 0.
 
 class TrigScintSD(simcfg.SensitiveDetector) :
     """Trigger Scintillaotr Sensitive Detector
@@ -127,11 +196,29 @@ class TrigScintSD(simcfg.SensitiveDetector) :
     vol : str
         Name of logical volume(s) that this SD should be attached to
         DEPENDS ON GDML
+    merge_steps : bool, optional
+        Merge the steps in a bar into a single hit with one contributor per
+        track and PDG instead of creating one hit per step.
+    min_time : float, optional
+        Start of the readout window [ns]. Steps whose track's global time is
+        earlier are dropped. Open by default since the tracks upstream of the
+        target have negative times.
+    max_time : float, optional
+        End of the readout window [ns]. Steps whose track's global time is
+        later are dropped. Open by default.
+    min_edep : float, optional
+        Minimum energy [MeV] deposited by a step for it to make a hit.
+        Geantino steps are not held to it. The energy of dropped steps is stored in the event header as
+        dropped_edep_<name of the SD>.
     """
     def __init__(self, module, name, vol) :
         super().__init__(f'trig_scint_{name}_sd', 'simcore::TrigScintSD','SimCore_SDs')
         self.module_id = module
         self.volume_name = vol
+        self.merge_steps = False
+        self.min_time = float('-inf')
+        self.max_time = float('inf')
+        self.min_edep = 0.
 
         coll = name+'SimHits'
         if name != 'Target' :
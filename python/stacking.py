@@ -0,0 +1,33 @@
+"""Configuration for the staged processing of tracks in the simulation"""
+
+class Stacking() :
+    """Parameters that determine which tracks are processed in the first stage
+
+    When staging is enabled, only the primaries and the tracks passing the
+    stage one predicate are processed in the first stage of an event. All
+    other tracks wait until the first stage is complete. UserActions of
+    the stacking type can then abort the event at the start of the next
+    stage (by overriding abortAtNewStage) before the waiting tracks are
+    processed.
+
+    Parameters
+    ----------
+    enable_staging : bool
+        Delay the tracks which do not pass the stage one predicate
+    stage_one_regions : list[str]
+        Names of the regions tracks need to be created in to be in stage one,
+        tracks created in any region pass if empty
+    stage_one_min_energy : float
+        Minimum kinetic energy of tracks in stage one [MeV]
+
+    Examples
+    --------
+        # only process the target region in the first stage
+        sim.stacking.enable_staging = True
+        sim.stacking.stage_one_regions = [ 'target' ]
+    """
+
+    def __init__(self) :
+        self.enable_staging = False
+        self.stage_one_regions = [ ]
+        self.stage_one_min_energy = 0.
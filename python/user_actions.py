@@ -0,0 +1,33 @@
+"""Configuration classes for the user actions shipped with SimCore"""
+
+from LDMX.SimCore import simcfg
+
+class StepProfiler(simcfg.UserAction) :
+    """Profile where the simulation spends its steps and its time
+
+    The time of one step out of every sample_period steps is measured
+    and attributed to the logical volume, region, particle, step-limiting
+    process and kinetic energy decade of the step. The time spent in the
+    sensitive detectors is measured on the same steps. A table of each
+    of these, sorted by time, is printed at the end of the run.
+
+    Parameters
+    ----------
+    sample_period : int, optional
+        Measure the time of one out of this many steps
+    max_rows : int, optional
+        Maximum number of rows to print in each table
+
+    Examples
+    --------
+        from LDMX.SimCore import user_actions
+        sim.actions.append(user_actions.StepProfiler())
+    """
+    def __init__(self, sample_period = 100, max_rows = 20) :
+        super().__init__('step_profiler', 'simcore::useractions::StepProfiler')
+
+        from LDMX.Framework import ldmxcfg
+        ldmxcfg.Process.addModule('SimCore_UserActions')
+
+        self.sample_period = sample_period
+        self.max_rows = max_rows
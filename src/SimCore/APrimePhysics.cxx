@@ -9,6 +9,7 @@
 
 #include "G4DarkBreM/G4APrime.h"
 #include "G4DarkBreM/G4DarkBreMModel.h"
+#include "SimCore/StartupTimers.h"
 #include "SimCore/UserEventInformation.h"
 
 // Geant4
@@ -81,6 +82,7 @@ void APrimePhysics::ConstructProcess() {
       }
       // Note: The process variable isn't used here, but creating the
       // G4DarkBremsstahlung object has side-effects
+      auto timer{StartupTimers::time("dark brem library")};
       process_ = std::make_unique<G4DarkBremsstrahlung>(
           std::make_shared<g4db::G4DarkBreMModel>(
               model.getParameter<std::string>("library_path"),
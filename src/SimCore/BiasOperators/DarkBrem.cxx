@@ -18,9 +18,7 @@ DarkBrem::DarkBrem(std::string name, const framework::config::Parameters& p)
 
 G4VBiasingOperation* DarkBrem::ProposeOccurenceBiasingOperation(
     const G4Track* track, const G4BiasingProcessInterface* callingProcess) {
-  std::string currentProcess =
-      callingProcess->GetWrappedProcess()->GetProcessName();
-  if (currentProcess.compare(this->getProcessToBias()) == 0) {
+  if (isProcessToBias(callingProcess)) {
     // bias only the primary particle if we don't want to bias all particles
     if (not bias_all_ and track->GetParentID() != 0) return nullptr;
 
@@ -18,9 +18,7 @@ G4VBiasingOperation* K0LongInelastic::ProposeOccurenceBiasingOperation(
     return nullptr;
   };
 
-  std::string currentProcess =
-      callingProcess->GetWrappedProcess()->GetProcessName();
-  if (currentProcess.compare(this->getProcessToBias()) == 0) {
+  if (isProcessToBias(callingProcess)) {
     G4double interactionLength =
         callingProcess->GetWrappedProcess()->GetCurrentInteractionLength();
 
@@ -18,7 +18,8 @@ PhotoNuclear::PhotoNuclear(std::string name,
 void PhotoNuclear::StartRun() {
   XsecBiasingOperator::StartRun();
 
-  if (processIsBiased(CONVERSION_PROCESS)) {
+  conversionProcess_ = findBiasedProcess(CONVERSION_PROCESS);
+  if (conversionProcess_) {
     emXsecOperation = new G4BOptnChangeCrossSection("changeXsec-conv");
   } else if (down_bias_conv_) {
     EXCEPTION_RAISE(
@@ -40,9 +41,7 @@ G4VBiasingOperation* PhotoNuclear::ProposeOccurenceBiasingOperation(
     return nullptr;
   }
 
-  std::string currentProcess =
-      callingProcess->GetWrappedProcess()->GetProcessName();
-  if (currentProcess.compare(this->getProcessToBias()) == 0) {
+  if (isProcessToBias(callingProcess)) {
     G4double interactionLength =
         callingProcess->GetWrappedProcess()->GetCurrentInteractionLength();
 
@@ -52,7 +51,8 @@ G4VBiasingOperation* PhotoNuclear::ProposeOccurenceBiasingOperation(
 
     return BiasedXsec(pnXsecBiased_);
   }
-  if ((currentProcess.compare(CONVERSION_PROCESS) == 0) and down_bias_conv_) {
+  if (callingProcess->GetWrappedProcess() == conversionProcess_ and
+      down_bias_conv_) {
     G4double interactionLength =
         callingProcess->GetWrappedProcess()->GetCurrentInteractionLength();
 
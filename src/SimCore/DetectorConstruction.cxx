@@ -2,6 +2,7 @@
 
 #include "Framework/Exception/Exception.h"
 #include "SimCore/SensitiveDetector.h"
+#include "SimCore/StartupTimers.h"
 #include "SimCore/XsecBiasingOperator.h"
 
 namespace simcore {
@@ -126,6 +127,7 @@ G4VPhysicalVolume* DetectorConstruction::Construct() {
 }
 
 void DetectorConstruction::ConstructSDandField() {
+  auto timer{StartupTimers::time("sensitive detectors")};
   auto sens_dets{
       parameters_.getParameter<std::vector<framework::config::Parameters>>(
           "sensitive_detectors", {})};
@@ -3,6 +3,18 @@
 // STL
 #include <iostream>
 
+namespace {
+/// number of contributions above which they are indexed
+constexpr unsigned INDEX_CONTRIBS_ABOVE{8};
+
+/// key of a contribution in the index
+std::uint64_t contribKey(int trackID, int pdgCode) {
+  return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(trackID))
+          << 32) |
+         static_cast<std::uint32_t>(pdgCode);
+}
+}  // namespace
+
 ClassImp(ldmx::SimCalorimeterHit)
 
     namespace ldmx {
@@ -16,6 +28,8 @@ ClassImp(ldmx::SimCalorimeterHit)
     pdgCodeContribs_.clear();
     edepContribs_.clear();
     timeContribs_.clear();
+    contribIndex_.clear();
+    contribIndexSize_ = 0;
 
     nContribs_ = 0;
     id_ = 0;
@@ -42,6 +56,11 @@ ClassImp(ldmx::SimCalorimeterHit)
     pdgCodeContribs_.push_back(pdgCode);
     edepContribs_.push_back(edep);
     timeContribs_.push_back(time);
+    if (contribIndexSize_ > 0 and contribIndexSize_ == nContribs_) {
+      // keep the first contribution for a key, like the linear search does
+      contribIndex_.emplace(contribKey(trackID, pdgCode), nContribs_);
+      ++contribIndexSize_;
+    }
     edep_ += edep;
     if (time < time_ || time_ == 0) {
       time_ = time;
@@ -49,6 +68,14 @@ ClassImp(ldmx::SimCalorimeterHit)
     ++nContribs_;
   }
 
+  void SimCalorimeterHit::reserveContribs(unsigned n) {
+    incidentIDContribs_.reserve(n);
+    trackIDContribs_.reserve(n);
+    pdgCodeContribs_.reserve(n);
+    edepContribs_.reserve(n);
+    timeContribs_.reserve(n);
+  }
+
   SimCalorimeterHit::Contrib SimCalorimeterHit::getContrib(int i) const {
     Contrib contrib;
     contrib.incidentID = incidentIDContribs_.at(i);
@@ -60,15 +87,30 @@ ClassImp(ldmx::SimCalorimeterHit)
   }
 
   int SimCalorimeterHit::findContribIndex(int trackID, int pdgCode) const {
-    int contribIndex = -1;
-    for (int iContrib = 0; iContrib < nContribs_; iContrib++) {
-      Contrib contrib = getContrib(iContrib);
-      if (contrib.trackID == trackID && contrib.pdgCode == pdgCode) {
-        contribIndex = iContrib;
-        break;
+    if (nContribs_ > INDEX_CONTRIBS_ABOVE) {
+      if (contribIndexSize_ != nContribs_) {
+        // build the index from the contributions added so far, keeping the
+        // first one for each key
+        contribIndex_.clear();
+        contribIndex_.reserve(2 * nContribs_);
+        for (unsigned iContrib = 0; iContrib < nContribs_; iContrib++) {
+          contribIndex_.emplace(contribKey(trackIDContribs_[iContrib],
+                                           pdgCodeContribs_[iContrib]),
+                                iContrib);
+        }
+        contribIndexSize_ = nContribs_;
+      }
+      auto it = contribIndex_.find(contribKey(trackID, pdgCode));
+      return it == contribIndex_.end() ? -1 : it->second;
+    }
+
+    for (unsigned iContrib = 0; iContrib < nContribs_; iContrib++) {
+      if (trackIDContribs_[iContrib] == trackID &&
+          pdgCodeContribs_[iContrib] == pdgCode) {
+        return iContrib;
       }
     }
-    return contribIndex;
+    return -1;
   }
 
   void SimCalorimeterHit::updateContrib(int i, float edep, float time) {
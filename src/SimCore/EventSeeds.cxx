@@ -0,0 +1,76 @@
+#include "SimCore/EventSeeds.h"
+
+/*~~~~~~~~~~~~~~~~*/
+/*   C++ StdLib   */
+/*~~~~~~~~~~~~~~~~*/
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+
+/*~~~~~~~~~~~~~~~*/
+/*   Framework   */
+/*~~~~~~~~~~~~~~~*/
+#include "Framework/Exception/Exception.h"
+
+/*~~~~~~~~~~~~*/
+/*   Geant4   */
+/*~~~~~~~~~~~~*/
+#include "Randomize.hh"
+
+namespace simcore {
+
+std::vector<int> deriveEventSeeds(const std::vector<int>& run_seeds, int run,
+                                  int event) {
+  if (run_seeds.size() < 2) {
+    EXCEPTION_RAISE("ConfigurationException",
+                    "Compact event seeds require the seeds of the run.");
+  }
+
+  // splitmix64: a counter-based generator that gives well mixed outputs
+  // for sequential inputs like event numbers
+  auto mix = [](uint64_t x) {
+    x += 0x9e3779b97f4a7c15;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111eb;
+    return x ^ (x >> 31);
+  };
+
+  // pack the two run seeds and the run and event numbers into two keys
+  auto pack = [](int high, int low) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(high)) << 32) |
+           static_cast<uint32_t>(low);
+  };
+  uint64_t run_key{pack(run_seeds[0], run_seeds[1])};
+  uint64_t event_key{pack(run, event)};
+  uint64_t key{mix(run_key ^ mix(event_key))};
+
+  // keep the seeds positive and move a zero out of the way since it
+  // would end the array of seeds given to the engine
+  auto seed = [&mix](uint64_t x) {
+    int s{static_cast<int>(mix(x) & 0x7fffffff)};
+    return s == 0 ? 1 : s;
+  };
+  return {seed(key), seed(key + 1)};
+}
+
+bool hasCompactEventSeeds(const ldmx::RunHeader& header) {
+  try {
+    return header.getIntParameter(COMPACT_EVENT_SEEDS_PARAMETER) != 0;
+  } catch (const std::out_of_range&) {
+    return false;
+  }
+}
+
+void restoreEventSeeds(const ldmx::EventHeader& header, bool compact) {
+  if (compact) {
+    // the engine stops reading its array of seeds at the first zero
+    long seeds[]{header.getIntParameter("eventSeed0"),
+                 header.getIntParameter("eventSeed1"), 0};
+    G4Random::setTheSeeds(seeds);
+  } else {
+    std::istringstream iss(header.getStringParameter("eventSeed"));
+    G4Random::restoreFullState(iss);
+  }
+}
+
+}  // namespace simcore
@@ -12,6 +12,7 @@
 #include "SimCore/G4User/TrackingAction.h"
 #include "SimCore/RunManager.h"
 #include "SimCore/TrackMap.h"
+#include "SimCore/UserEventInformation.h"
 
 /*~~~~~~~~~~~~*/
 /*   Geant4   */
@@ -26,6 +27,10 @@ void EventAction::BeginOfEventAction(const G4Event* event) {
   // Clear the global track map.
   simcore::g4user::TrackingAction::get()->getTrackMap().clear();
 
+  // Start measuring how long this event takes
+  static_cast<UserEventInformation*>(event->GetUserInformation())
+      ->startTimers();
+
   // Call user event actions
   for (auto& eventAction : eventActions_) {
     eventAction->BeginOfEventAction(event);
@@ -37,6 +42,9 @@ void EventAction::EndOfEventAction(const G4Event* event) {
   for (auto& eventAction : eventActions_) {
     eventAction->EndOfEventAction(event);
   }
+
+  static_cast<UserEventInformation*>(event->GetUserInformation())
+      ->stopTimers();
 }
 
 }  // namespace g4user
@@ -1,13 +1,48 @@
 #include "SimCore/G4User/StackingAction.h"
 
+#include <algorithm>
+
+#include "Framework/Exception/Exception.h"
+#include "G4RegionStore.hh"
+#include "G4RunManager.hh"
+#include "G4StackManager.hh"
+#include "G4VPhysicalVolume.hh"
+
 namespace simcore {
 namespace g4user {
 
+StackingAction::StackingAction(
+    const framework::config::Parameters& parameters) {
+  enable_staging_ = parameters.getParameter<bool>("enable_staging", false);
+  stage_one_min_energy_ =
+      parameters.getParameter<double>("stage_one_min_energy", 0.);
+  // The geometry has been constructed by the time the actions are built,
+  // so we can look up the regions once here
+  for (const auto& name : parameters.getParameter<std::vector<std::string>>(
+           "stage_one_regions", {})) {
+    auto region{G4RegionStore::GetInstance()->GetRegion(name, false)};
+    if (not region) {
+      EXCEPTION_RAISE("StackingConfig",
+                      "Stage one region '" + name + "' does not exist.");
+    }
+    stage_one_regions_.push_back(region);
+  }
+}
+
 G4ClassificationOfNewTrack StackingAction::ClassifyNewTrack(
     const G4Track* track) {
-  // Default value of a track is fUrgent.
+  // Keep track of how many tracks are waiting to be processed
+  static_cast<UserEventInformation*>(
+      G4EventManager::GetEventManager()->GetUserInformation())
+      ->updatePeakStackSize(stackManager->GetNTotalTrack());
+
+  // Default value of a track is fUrgent, unless we are staging and
+  // it doesn't belong in the first stage.
   G4ClassificationOfNewTrack currentTrackClass =
       G4ClassificationOfNewTrack::fUrgent;
+  if (enable_staging_ and stages_completed_ == 0 and not isStageOne(track)) {
+    currentTrackClass = G4ClassificationOfNewTrack::fWaiting;
+  }
 
   // Get proposed new track classification from this plugin.
   for (auto& stackingAction : stackingActions_) {
@@ -23,13 +58,41 @@ G4ClassificationOfNewTrack StackingAction::ClassifyNewTrack(
 }
 
 void StackingAction::NewStage() {
+  stages_completed_++;
   for (auto& stackingAction : stackingActions_) stackingAction->NewStage();
+
+  // Geant4 clears the stacks when the event is aborted, so none of
+  // the waiting tracks will be processed
+  for (auto& stackingAction : stackingActions_) {
+    if (stackingAction->abortAtNewStage(stages_completed_)) {
+      G4RunManager::GetRunManager()->AbortEvent();
+      return;
+    }
+  }
 }
 
 void StackingAction::PrepareNewEvent() {
+  stages_completed_ = 0;
   for (auto& stackingAction : stackingActions_)
     stackingAction->PrepareNewEvent();
 }
 
+bool StackingAction::isStageOne(const G4Track* track) const {
+  // primaries are always processed first
+  if (track->GetParentID() == 0) return true;
+
+  if (track->GetKineticEnergy() < stage_one_min_energy_) return false;
+
+  if (stage_one_regions_.empty()) return true;
+
+  // new secondaries share the touchable of their parent, so this is the
+  // volume they were created in
+  const G4VPhysicalVolume* volume{track->GetVolume()};
+  if (not volume) return false;
+  const G4Region* region{volume->GetLogicalVolume()->GetRegion()};
+  return std::find(stage_one_regions_.begin(), stage_one_regions_.end(),
+                   region) != stage_one_regions_.end();
+}
+
 }  // namespace g4user
 }  // namespace simcore
@@ -1,11 +1,15 @@
 #include "SimCore/G4User/SteppingAction.h"
 
+#include "SimCore/ProcessRegistry.h"
+
 namespace simcore::g4user {
 
 void SteppingAction::UserSteppingAction(const G4Step* step) {
   auto event_info{static_cast<UserEventInformation*>(
       G4EventManager::GetEventManager()->GetUserInformation())};
 
+  event_info->incStepCount();
+
   // get the track weights before this step and after this step
   //  ** these weights include the factors of all upstream step weights **
   double track_weight_pre_step = step->GetPreStepPoint()->GetWeight();
@@ -33,20 +37,20 @@ void SteppingAction::UserSteppingAction(const G4Step* step) {
   if (secondaries) {
     double delta_energy = step->GetPreStepPoint()->GetKineticEnergy() -
                           step->GetPostStepPoint()->GetKineticEnergy();
+    const ProcessRegistry& processes{ProcessRegistry::getInstance()};
     for (const G4Track* secondary : *secondaries) {
       const G4VProcess* creator{secondary->GetCreatorProcess()};
       if (creator) {
-        const G4String& creator_name{creator->GetProcessName()};
-        if (creator_name.contains("photonNuclear")) {
+        if (processes.is(creator, ProcessRegistry::PHOTO_NUCLEAR)) {
           event_info->addPNEnergy(delta_energy);
           event_info->lastStepWasPN(true);
           break;  // done <- assumes first match determines step process
         }
-        if (creator_name.contains("electronNuclear")) {
+        if (processes.is(creator, ProcessRegistry::ELECTRO_NUCLEAR)) {
           event_info->addENEnergy(delta_energy);
           event_info->lastStepWasEN(true);
           break;  // done <- assumes first match determines step process
-        }         // creator name matches PN or EN
+        }         // creator is PN or EN
       }           // creator exists
     }             // loop over secondaries
   }               // secondaries list was created
@@ -17,6 +17,9 @@ namespace simcore::g4user {
 void TrackingAction::PreUserTrackingAction(const G4Track* track) {
   if (not trackMap_.contains(track)) {
     // New Track
+    static_cast<UserEventInformation*>(
+        G4EventManager::GetEventManager()->GetUserInformation())
+        ->incTracksCreated();
 
     // get track information and initialize our new track
     //  this will create a new track info object if it doesn't exist
@@ -24,9 +27,7 @@ void TrackingAction::PreUserTrackingAction(const G4Track* track) {
     track_info->initialize(track);
 
     // Get the region info for where the track was created (could be NULL)
-    auto regionInfo = (UserRegionInformation*)track->GetLogicalVolumeAtVertex()
-                          ->GetRegion()
-                          ->GetUserInformation();
+    auto regionInfo{UserRegionInformation::get(track)};
 
     // Get the gen status if track was primary
     int curGenStatus = -1;
@@ -79,6 +80,9 @@ void TrackingAction::PostUserTrackingAction(const G4Track* track) {
   if (track_info->getSaveFlag() and
       track->GetTrackStatus() == G4TrackStatus::fStopAndKill) {
     trackMap_.save(track);
+    static_cast<UserEventInformation*>(
+        G4EventManager::GetEventManager()->GetUserInformation())
+        ->incTracksSaved();
   }
 }
 
@@ -4,6 +4,7 @@
 #include "Framework/Exception/Exception.h"
 #include "SimCore/MagneticFieldMap3D.h"
 #include "SimCore/MagneticFieldStore.h"
+#include "SimCore/StartupTimers.h"
 #include "SimCore/UserRegionInformation.h"
 #include "SimCore/VisAttributesStore.h"
 
@@ -194,8 +195,11 @@ void AuxInfoReader::createMagneticField(const G4String& magFieldName,
     }
 
     // Create new 3D field map.
-    magField =
-        new MagneticFieldMap3D(fileName.c_str(), offsetX, offsetY, offsetZ);
+    {
+      auto timer{StartupTimers::time("field map")};
+      magField =
+          new MagneticFieldMap3D(fileName.c_str(), offsetX, offsetY, offsetZ);
+    }
 
     // Assign field map as global field.
     G4FieldManager* fieldMgr =
@@ -230,8 +234,11 @@ void AuxInfoReader::createRegion(const G4String& name,
       }
     }
   }
-  G4VUserRegionInformation* regionInfo =
-      new UserRegionInformation(storeTrajectories);
+  // We rely on the fact that the calorimeter region is named
+  //  'CalorimeterRegion'
+  // and no other region names contain the string 'Calorimeter'
+  G4VUserRegionInformation* regionInfo = new UserRegionInformation(
+      storeTrajectories, name.contains("Calorimeter"));
   // This looks like a memory leak, but isn't. I (Einar) have checked. Geant4
   // registers the region in the constructor and deletes it at the end.
   //
@@ -54,20 +54,8 @@ MagneticFieldMap3D::MagneticFieldMap3D(const char* filename, double xOffset,
   G4cout << "  Number of values: " << nx_ << " " << ny_ << " " << nz_ << G4endl;
 
   // Set up storage space for table
-  xField_.resize(nx_);
-  yField_.resize(nx_);
-  zField_.resize(nx_);
+  field_.resize(static_cast<std::size_t>(nx_) * ny_ * nz_ * 3);
   int ix, iy, iz;
-  for (ix = 0; ix < nx_; ix++) {
-    xField_[ix].resize(ny_);
-    yField_[ix].resize(ny_);
-    zField_[ix].resize(ny_);
-    for (iy = 0; iy < ny_; iy++) {
-      xField_[ix][iy].resize(nz_);
-      yField_[ix][iy].resize(nz_);
-      zField_[ix][iy].resize(nz_);
-    }
-  }
 
   // Ignore other header information
   // The first line whose second character is '0' is considered to
@@ -87,9 +75,10 @@ MagneticFieldMap3D::MagneticFieldMap3D(const char* filename, double xOffset,
           miny_ = yval;
           minz_ = zval;
         }
-        xField_[ix][iy][iz] = bx;
-        yField_[ix][iy][iz] = by;
-        zField_[ix][iy][iz] = bz;
+        std::size_t index = ((ix * ny_ + iy) * nz_ + iz) * 3;
+        field_[index] = bx;
+        field_[index + 1] = by;
+        field_[index + 2] = bz;
       }
     }
   }
@@ -201,54 +190,25 @@ void MagneticFieldMap3D::GetFieldValue(const double point[4],
 #endif
 
     // Full 3-dimensional version
-    bfield[0] =
-        xField_[xindex][yindex][zindex] * (1 - xlocal) * (1 - ylocal) *
-            (1 - zlocal) +
-        xField_[xindex][yindex][zindex + 1] * (1 - xlocal) * (1 - ylocal) *
-            zlocal +
-        xField_[xindex][yindex + 1][zindex] * (1 - xlocal) * ylocal *
-            (1 - zlocal) +
-        xField_[xindex][yindex + 1][zindex + 1] * (1 - xlocal) * ylocal *
-            zlocal +
-        xField_[xindex + 1][yindex][zindex] * xlocal * (1 - ylocal) *
-            (1 - zlocal) +
-        xField_[xindex + 1][yindex][zindex + 1] * xlocal * (1 - ylocal) *
-            zlocal +
-        xField_[xindex + 1][yindex + 1][zindex] * xlocal * ylocal *
-            (1 - zlocal) +
-        xField_[xindex + 1][yindex + 1][zindex + 1] * xlocal * ylocal * zlocal;
-    bfield[1] =
-        yField_[xindex][yindex][zindex] * (1 - xlocal) * (1 - ylocal) *
-            (1 - zlocal) +
-        yField_[xindex][yindex][zindex + 1] * (1 - xlocal) * (1 - ylocal) *
-            zlocal +
-        yField_[xindex][yindex + 1][zindex] * (1 - xlocal) * ylocal *
-            (1 - zlocal) +
-        yField_[xindex][yindex + 1][zindex + 1] * (1 - xlocal) * ylocal *
-            zlocal +
-        yField_[xindex + 1][yindex][zindex] * xlocal * (1 - ylocal) *
-            (1 - zlocal) +
-        yField_[xindex + 1][yindex][zindex + 1] * xlocal * (1 - ylocal) *
-            zlocal +
-        yField_[xindex + 1][yindex + 1][zindex] * xlocal * ylocal *
-            (1 - zlocal) +
-        yField_[xindex + 1][yindex + 1][zindex + 1] * xlocal * ylocal * zlocal;
-    bfield[2] =
-        zField_[xindex][yindex][zindex] * (1 - xlocal) * (1 - ylocal) *
-            (1 - zlocal) +
-        zField_[xindex][yindex][zindex + 1] * (1 - xlocal) * (1 - ylocal) *
-            zlocal +
-        zField_[xindex][yindex + 1][zindex] * (1 - xlocal) * ylocal *
-            (1 - zlocal) +
-        zField_[xindex][yindex + 1][zindex + 1] * (1 - xlocal) * ylocal *
-            zlocal +
-        zField_[xindex + 1][yindex][zindex] * xlocal * (1 - ylocal) *
-            (1 - zlocal) +
-        zField_[xindex + 1][yindex][zindex + 1] * xlocal * (1 - ylocal) *
-            zlocal +
-        zField_[xindex + 1][yindex + 1][zindex] * xlocal * ylocal *
-            (1 - zlocal) +
-        zField_[xindex + 1][yindex + 1][zindex + 1] * xlocal * ylocal * zlocal;
+    for (int component{0}; component < 3; component++) {
+      bfield[component] =
+          at(xindex, yindex, zindex, component) * (1 - xlocal) *
+              (1 - ylocal) * (1 - zlocal) +
+          at(xindex, yindex, zindex + 1, component) * (1 - xlocal) *
+              (1 - ylocal) * zlocal +
+          at(xindex, yindex + 1, zindex, component) * (1 - xlocal) * ylocal *
+              (1 - zlocal) +
+          at(xindex, yindex + 1, zindex + 1, component) * (1 - xlocal) *
+              ylocal * zlocal +
+          at(xindex + 1, yindex, zindex, component) * xlocal * (1 - ylocal) *
+              (1 - zlocal) +
+          at(xindex + 1, yindex, zindex + 1, component) * xlocal *
+              (1 - ylocal) * zlocal +
+          at(xindex + 1, yindex + 1, zindex, component) * xlocal * ylocal *
+              (1 - zlocal) +
+          at(xindex + 1, yindex + 1, zindex + 1, component) * xlocal * ylocal *
+              zlocal;
+    }
 
   } else {
     bfield[0] = 0.0;
@@ -0,0 +1,74 @@
+#include "SimCore/ProcessRegistry.h"
+
+/*~~~~~~~~~~~~*/
+/*   Geant4   */
+/*~~~~~~~~~~~~*/
+#include "G4BiasingProcessInterface.hh"
+#include "G4DarkBreM/G4DarkBremsstrahlung.h"
+#include "G4Electron.hh"
+#include "G4ParticleDefinition.hh"
+#include "G4ParticleTable.hh"
+#include "G4ProcessManager.hh"
+#include "G4VProcess.hh"
+
+namespace simcore {
+
+ProcessRegistry& ProcessRegistry::getInstance() {
+  static thread_local ProcessRegistry instance;
+  return instance;
+}
+
+void ProcessRegistry::build() {
+  entries_.clear();
+  electron_dark_brem_ = nullptr;
+
+  auto particle_it{G4ParticleTable::GetParticleTable()->GetIterator()};
+  particle_it->reset();
+  while ((*particle_it)()) {
+    const G4ParticleDefinition* particle{particle_it->value()};
+    G4ProcessManager* pman{particle->GetProcessManager()};
+    if (not pman) continue;
+    G4ProcessVector* processes{pman->GetProcessList()};
+    for (std::size_t i_proc{0}; i_proc < processes->size(); i_proc++) {
+      G4VProcess* process{(*processes)[i_proc]};
+      Entry entry{identify(process)};
+      entries_.emplace(process, entry);
+      // the wrapper's name includes the wrapped process's name, so they
+      // share their identity
+      if (auto wrapper{dynamic_cast<G4BiasingProcessInterface*>(process)};
+          wrapper and wrapper->GetWrappedProcess()) {
+        entries_.emplace(wrapper->GetWrappedProcess(), entry);
+      }
+      if (particle == G4Electron::Definition() and
+          (entry.roles & DARK_BREM) and not electron_dark_brem_) {
+        electron_dark_brem_ = process;
+      }
+    }
+  }
+}
+
+ldmx::SimParticle::ProcessType ProcessRegistry::getType(
+    const G4VProcess* process) const {
+  if (not process) return ldmx::SimParticle::ProcessType::unknown;
+  auto entry{entries_.find(process)};
+  if (entry != entries_.end()) return entry->second.type;
+  return identify(process).type;
+}
+
+unsigned ProcessRegistry::getRoles(const G4VProcess* process) const {
+  if (not process) return NONE;
+  auto entry{entries_.find(process)};
+  if (entry != entries_.end()) return entry->second.roles;
+  return identify(process).roles;
+}
+
+ProcessRegistry::Entry ProcessRegistry::identify(const G4VProcess* process) {
+  const G4String& name{process->GetProcessName()};
+  unsigned roles{NONE};
+  if (name.contains("photonNuclear")) roles |= PHOTO_NUCLEAR;
+  if (name.contains("electronNuclear")) roles |= ELECTRO_NUCLEAR;
+  if (name.contains(G4DarkBremsstrahlung::PROCESS_NAME)) roles |= DARK_BREM;
+  return {ldmx::SimParticle::findProcessType(name), roles};
+}
+
+}  // namespace simcore
@@ -1,5 +1,7 @@
 #include "SimCore/ReSimulator.h"
 
+#include "SimCore/EventSeeds.h"
+
 namespace simcore {
 
 void ReSimulator::configure(framework::config::Parameters& parameters) {
@@ -25,6 +27,10 @@ void ReSimulator::configure(framework::config::Parameters& parameters) {
   }
 }
 
+void ReSimulator::onNewRun(const ldmx::RunHeader& header) {
+  compact_event_seeds_ = hasCompactEventSeeds(header);
+}
+
 void ReSimulator::produce(framework::Event& event) {
   /* numEventsBegan_++; */
   auto& eventHeader{event.getEventHeader()};
@@ -42,8 +48,7 @@ void ReSimulator::produce(framework::Event& event) {
     std::cout << "Resimulating " << eventNumber << std::endl;
   }
 
-  std::istringstream iss(eventHeader.getStringParameter("eventSeed"));
-  G4Random::restoreFullState(iss);
+  restoreEventSeeds(eventHeader, compact_event_seeds_);
   runManager_->ProcessOneEvent(eventNumber);
   if (verbosity_ > 1) {
     std::cout << "Finished with event number " << eventNumber << std::endl;
@@ -61,11 +66,11 @@ void ReSimulator::produce(framework::Event& event) {
 
   eventHeader.setEventNumber(++events_resimulated_);
   updateEventHeader(eventHeader);
+  terminateEvent();
+
   saveTracks(event);
 
   saveSDHits(event);
-
-  runManager_->TerminateOneEvent();
 }
 
 bool ReSimulator::skip(framework::Event& event) const {
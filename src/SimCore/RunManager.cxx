@@ -6,20 +6,28 @@
 
 #include "SimCore/RunManager.h"
 
+/*~~~~~~~~~~~~~~~~*/
+/*   C++ StdLib   */
+/*~~~~~~~~~~~~~~~~*/
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <regex>
+#include <set>
+#include <sstream>
+#include <unistd.h>
+
 //-------------//
 //   ldmx-sw   //
 //-------------//
-#include "G4DarkBreM/G4DarkBremsstrahlung.h"  //for process name
 #include "SimCore/APrimePhysics.h"
 #include "SimCore/DetectorConstruction.h"
-#include "SimCore/G4User/EventAction.h"
-#include "SimCore/G4User/PrimaryGeneratorAction.h"
-#include "SimCore/G4User/RunAction.h"
-#include "SimCore/G4User/StackingAction.h"
-#include "SimCore/G4User/SteppingAction.h"
-#include "SimCore/G4User/TrackingAction.h"
+#include "SimCore/G4User/ActionInitialization.h"
 #include "SimCore/GammaPhysics.h"
 #include "SimCore/ParallelWorld.h"
+#include "SimCore/ProcessRegistry.h"
+#include "SimCore/StartupTimers.h"
 #include "SimCore/XsecBiasingOperator.h"
 
 //------------//
@@ -34,6 +42,52 @@
 
 namespace simcore {
 
+namespace {
+
+/**
+ * Append the content of a GDML file and of the files it includes
+ *
+ * Both XML entities (<!ENTITY name SYSTEM "file">) and GDML modules
+ * (<file name="file"/>) are followed. Their paths are taken relative to
+ * the including file if they exist there and as given otherwise.
+ *
+ * @param[in,out] config stream to append the content to
+ * @param[in] path path to the GDML file
+ * @param[in,out] visited files that were already appended
+ */
+void appendGDML(std::ostream& config, const std::filesystem::path& path,
+                std::set<std::filesystem::path>& visited) {
+  if (not visited.insert(path.lexically_normal()).second) return;
+  std::ifstream file{path};
+  if (not file) return;
+  std::string content{std::istreambuf_iterator<char>(file),
+                      std::istreambuf_iterator<char>()};
+  config << path.string() << '\n' << content << '\n';
+
+  static const std::regex include{
+      R"re(<!ENTITY\s+\S+\s+SYSTEM\s+"([^"]+)")re"
+      R"re(|<file\s+name\s*=\s*"([^"]+)")re"};
+  for (std::sregex_iterator match{content.begin(), content.end(), include};
+       match != std::sregex_iterator{}; ++match) {
+    std::filesystem::path included{(*match)[1].matched ? (*match)[1].str()
+                                                        : (*match)[2].str()};
+    if (included.is_relative() and
+        std::filesystem::exists(path.parent_path() / included)) {
+      included = path.parent_path() / included;
+    }
+    appendGDML(config, included, visited);
+  }
+}
+
+/// Append a list of values on its own line
+template <typename T>
+void appendList(std::ostream& config, const std::vector<T>& values) {
+  for (const auto& value : values) config << value << ' ';
+  config << '\n';
+}
+
+}  // namespace
+
 RunManager::RunManager(framework::config::Parameters& parameters,
                        ConditionsInterface&) {
   parameters_ = parameters;
@@ -102,6 +156,23 @@ void RunManager::setupPhysics() {
 void RunManager::Initialize() {
   setupPhysics();
 
+  // Look for tables built by an earlier job with the same physics
+  // configuration. If any of them fail to be retrieved, Geant4 warns
+  // and builds them instead.
+  auto physics_table_cache{
+      parameters_.getParameter<std::string>("physics_table_cache", "")};
+  if (!physics_table_cache.empty()) {
+    physicsTableKey_ = physicsTableKey();
+    physicsTableDir_ = physics_table_cache + "/" + physicsTableKey_;
+    physicsTablesRetrieved_ =
+        std::filesystem::exists(physicsTableDir_ + "/complete");
+    if (physicsTablesRetrieved_) {
+      std::cout << "[ RunManager ]: Retrieving physics tables from '"
+                << physicsTableDir_ << "'." << std::endl;
+      physicsList->SetPhysicsTableRetrieved(physicsTableDir_);
+    }
+  }
+
   // The parallel world needs to be registered before the mass world is
   // constructed i.e. before G4RunManager::Initialize() is called.
   if (isPWEnabled_) {
@@ -109,6 +180,7 @@ void RunManager::Initialize() {
               << std::endl;
 
     auto validateGeometry_{parameters_.getParameter<bool>("validate_detector")};
+    auto timer{StartupTimers::time("parallel world")};
     G4GDMLParser* pwParser = new G4GDMLParser();
     pwParser->Read(parallelWorldPath_, validateGeometry_);
     this->getDetectorConstruction()->RegisterParallelWorld(
@@ -119,67 +191,150 @@ void RunManager::Initialize() {
   // their processes
   //  They are constructed in order, so it is important to register the biasing
   //  physics *after* any other processes that need to be able to be biased
-  G4RunManager::Initialize();
-
-  // create our G4User actions
-  auto primary_action{new g4user::PrimaryGeneratorAction(parameters_)};
-  auto run_action{new g4user::RunAction};
-  auto event_action{new g4user::EventAction};
-  auto tracking_action{new g4user::TrackingAction};
-  auto stepping_action{new g4user::SteppingAction};
-  auto stacking_action{new g4user::StackingAction};
-  // ...and register them with G4
-  SetUserAction(primary_action);
-  SetUserAction(run_action);
-  SetUserAction(event_action);
-  SetUserAction(tracking_action);
-  SetUserAction(stepping_action);
-  SetUserAction(stacking_action);
-
-  // Create all user actions and attch them to the corresponding G4 actions
-  auto user_actions{
-      parameters_.getParameter<std::vector<framework::config::Parameters>>(
-          "actions", {})};
-  for (auto& user_action : user_actions) {
-    auto ua = UserAction::Factory::get().make(
-        user_action.getParameter<std::string>("class_name"),
-        user_action.getParameter<std::string>("instance_name"), user_action);
-    for (auto& type : ua->getTypes()) {
-      if (type == simcore::TYPE::RUN) {
-        run_action->registerAction(ua.get());
-      } else if (type == simcore::TYPE::EVENT) {
-        event_action->registerAction(ua.get());
-      } else if (type == simcore::TYPE::TRACKING) {
-        tracking_action->registerAction(ua.get());
-      } else if (type == simcore::TYPE::STEPPING) {
-        stepping_action->registerAction(ua.get());
-      } else if (type == simcore::TYPE::STACKING) {
-        stacking_action->registerAction(ua.get());
-      } else {
-        EXCEPTION_RAISE("ActionType", "Action type does not exist.");
-      }
-    }
+  {
+    auto timer{StartupTimers::time("G4 initialize")};
+    G4RunManager::Initialize();
+  }
+
+  // now that the processes are constructed, map them to their identity
+  ProcessRegistry::getInstance().build();
+
+  // create our G4User actions and attach the UserActions to them
+  //  Geant4 calls ActionInitialization::Build on each worker thread
+  //  when running multi-threaded. Only the G4User actions and their
+  //  TrackMap are made per Build, the generators and UserActions stay
+  //  in the global Factory warehouse.
+  SetUserInitialization(new g4user::ActionInitialization(parameters_));
+}
+
+void RunManager::RunInitialization() {
+  {
+    auto timer{StartupTimers::time("run initialization")};
+    G4RunManager::RunInitialization();
+  }
+
+  if (physicsTableDir_.empty() or physicsTablesRetrieved_) return;
+
+  // Store into a directory unique to this process and then move it into
+  // place so that jobs starting at the same time never see a partially
+  // written cache entry.
+  std::string staging_dir{physicsTableDir_ + ".tmp" +
+                          std::to_string(::getpid())};
+  std::error_code ec;
+  std::filesystem::create_directories(staging_dir, ec);
+  if (ec or not physicsList->StorePhysicsTable(staging_dir)) {
+    std::cerr << "[ RunManager ]: Unable to store physics tables in '"
+              << staging_dir << "'." << std::endl;
+    std::filesystem::remove_all(staging_dir, ec);
+    return;
+  }
+  std::ofstream{staging_dir + "/complete"} << physicsTableKey_ << std::endl;
+
+  std::filesystem::rename(staging_dir, physicsTableDir_, ec);
+  if (ec) {
+    // another job already stored the same tables
+    std::filesystem::remove_all(staging_dir, ec);
+  } else {
+    std::cout << "[ RunManager ]: Stored physics tables in '"
+              << physicsTableDir_ << "'." << std::endl;
+  }
+}
+
+std::string RunManager::physicsTableKey() const {
+  std::stringstream config;
+
+  // the content of the tables depends on the version of Geant4
+  config << kernel->GetVersionString() << '\n';
+
+  // the materials and the production cuts come from the detector
+  // descriptions, so we include their content and not just their path
+  std::set<std::filesystem::path> visited;
+  for (const auto& name : {"detector", "scoringPlanes"}) {
+    auto path{parameters_.getParameter<std::string>(name, "")};
+    config << name << '=' << path << '\n';
+    if (not path.empty()) appendGDML(config, path, visited);
+  }
+
+  for (const auto& cmd : parameters_.getParameter<std::vector<std::string>>(
+           "preInitCommands", {})) {
+    config << cmd << '\n';
+  }
+
+  auto photonuclear_model{
+      parameters_.getParameter<framework::config::Parameters>(
+          "photonuclear_model")};
+  config << photonuclear_model.getParameter<std::string>("class_name") << ' '
+         << photonuclear_model.getParameter<double>("hard_particle_threshold",
+                                                    0.)
+         << ' ' << photonuclear_model.getParameter<int>("zmin", 0) << ' '
+         << photonuclear_model.getParameter<double>("emin", 0.) << ' '
+         << photonuclear_model.getParameter<bool>("count_light_ions", false)
+         << ' ' << photonuclear_model.getParameter<int>("min_products", 0)
+         << ' ';
+  appendList(config,
+             photonuclear_model.getParameter<std::vector<int>>("pdg_ids", {}));
+
+  auto dark_brem{
+      parameters_.getParameter<framework::config::Parameters>("dark_brem")};
+  config << dark_brem.getParameter<bool>("enable", false) << ' '
+         << dark_brem.getParameter<double>("ap_mass", 0.) << ' '
+         << dark_brem.getParameter<bool>("only_one_per_event", false) << ' '
+         << dark_brem.getParameter<bool>("cache_xsec", false) << '\n';
+  if (dark_brem.getParameter<bool>("enable", false)) {
+    auto model{dark_brem.getParameter<framework::config::Parameters>("model")};
+    config << model.getParameter<std::string>("name") << ' '
+           << model.getParameter<std::string>("library_path", "") << ' '
+           << model.getParameter<std::string>("method", "") << ' '
+           << model.getParameter<double>("threshold", 0.) << ' '
+           << model.getParameter<double>("epsilon", 0.) << '\n';
+  }
+
+  auto kaon_parameters{parameters_.getParameter<framework::config::Parameters>(
+      "kaon_parameters")};
+  for (const auto& name :
+       {"kplus_branching_ratios", "kminus_branching_ratios",
+        "k0l_branching_ratios", "k0s_branching_ratios"}) {
+    appendList(config,
+               kaon_parameters.getParameter<std::vector<double>>(name, {}));
+  }
+  for (const auto& name :
+       {"kplus_lifetime_factor", "kminus_lifetime_factor",
+        "k0l_lifetime_factor", "k0s_lifetime_factor"}) {
+    config << kaon_parameters.getParameter<double>(name) << ' ';
+  }
+  config << '\n';
+
+  for (auto& bop :
+       parameters_.getParameter<std::vector<framework::config::Parameters>>(
+           "biasing_operators", {})) {
+    config << bop.getParameter<std::string>("class_name") << ' '
+           << bop.getParameter<std::string>("instance_name") << ' '
+           << bop.getParameter<std::string>("volume", "") << '\n';
   }
+
+  // 64-bit FNV-1a
+  uint64_t hash{0xcbf29ce484222325};
+  for (unsigned char c : config.str()) {
+    hash ^= c;
+    hash *= 0x100000001b3;
+  }
+
+  std::stringstream key;
+  key << std::hex << hash;
+  return key.str();
 }
 
 void RunManager::TerminateOneEvent() {
   // have geant4 do its own thing
   G4RunManager::TerminateOneEvent();
 
-  // go through the processes attached to the electron and
-  // reactivate any process that contains the G4DarkBremmstrahlung name
-  // this covers both cases where the process is biased and not
-  static auto reactivate_dark_brem = [](G4ProcessManager* pman) {
-    for (int i_proc{0}; i_proc < pman->GetProcessList()->size(); i_proc++) {
-      G4VProcess* p{(*(pman->GetProcessList()))[i_proc]};
-      if (p->GetProcessName().contains(G4DarkBremsstrahlung::PROCESS_NAME)) {
-        pman->SetProcessActivation(p, true);
-        break;
-      }
-    }
-  };
-
-  reactivate_dark_brem(G4Electron::Definition()->GetProcessManager());
+  // reactivate the dark brem process attached to the electron
+  // this is the biasing wrapper if the process is biased
+  auto dark_brem{ProcessRegistry::getInstance().getElectronDarkBrem()};
+  if (dark_brem) {
+    G4Electron::Definition()->GetProcessManager()->SetProcessActivation(
+        dark_brem, true);
+  }
 
   if (this->GetVerboseLevel() > 1) {
     std::cout << "[ RunManager ] : "
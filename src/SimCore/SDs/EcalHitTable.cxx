@@ -0,0 +1,175 @@
+#include "SimCore/SDs/EcalHitTable.h"
+
+/*~~~~~~~~~~~~~~~~*/
+/*   C++ StdLib   */
+/*~~~~~~~~~~~~~~~~*/
+#include <algorithm>
+#include <cstdint>
+
+namespace simcore {
+
+namespace {
+/**
+ * hash of a cell for the table of hits
+ *
+ * The low bits of the raw ID are the cell within the module, so the
+ * upper half of the product is folded in to spread the same cell in
+ * different modules and layers over the table.
+ */
+std::size_t cellHash(unsigned int raw) {
+  std::uint64_t hash{raw * 0x9e3779b97f4a7c15ull};
+  return hash ^ (hash >> 32);
+}
+
+/// hash of a contribution to a hit for the table of contributions
+std::size_t contribHash(std::size_t hit, int track_id, int pdg) {
+  std::size_t hash{hit * 2654435761u};
+  hash ^= static_cast<std::uint32_t>(track_id) * 2246822519u;
+  hash ^= static_cast<std::uint32_t>(pdg) * 3266489917u;
+  return hash ^ (hash >> 16);
+}
+}  // namespace
+
+std::size_t EcalHitTable::findHit(ldmx::EcalID id, bool& created) {
+  // keep the table at most half full so the probe sequences stay short
+  if (2 * (hits_.size() + 1) > slots_.size()) growTable();
+
+  std::size_t mask{slots_.size() - 1};
+  unsigned int raw{id.raw()};
+  std::size_t slot{cellHash(raw) & mask};
+  while (slots_[slot].hit >= 0) {
+    if (slots_[slot].id == raw) {
+      created = false;
+      return slots_[slot].hit;
+    }
+    slot = (slot + 1) & mask;
+  }
+
+  slots_[slot] = {raw, static_cast<int>(hits_.size())};
+  touched_.push_back(slot);
+  created = true;
+  hits_.emplace_back();
+  contrib_lists_.emplace_back();
+  return hits_.size() - 1;
+}
+
+void EcalHitTable::addStep(std::size_t hit, int incident_id, int track_id,
+                           int pdg, double edep, double time) {
+  if (enable_contribs_) {
+    // contributions are collected in the arena and copied into the hit
+    // once it is complete in stage
+    bool created{true};
+    Contrib& contrib{compress_contribs_
+                         ? findContrib(hit, track_id, pdg, created)
+                         : newContrib(hit, track_id, pdg)};
+    if (created) {
+      contrib.incident_id = incident_id;
+      contrib.time = time;
+    } else if (time < contrib.time) {
+      contrib.time = time;
+    }
+    contrib.edep += edep;
+  } else {
+    // no hit contribs and hit already exists
+    auto& the_hit{hits_[hit]};
+    the_hit.setEdep(the_hit.getEdep() + edep);
+    if (time < the_hit.getTime() or the_hit.getTime() == 0) {
+      the_hit.setTime(time);
+    }
+  }
+}
+
+void EcalHitTable::stage(std::vector<ldmx::SimCalorimeterHit>& hits) {
+  hits.clear();
+  hits.swap(hits_);
+  if (enable_contribs_) {
+    for (std::size_t i_hit{0}; i_hit < hits.size(); i_hit++) {
+      auto& hit{hits[i_hit]};
+      const ContribList& list{contrib_lists_[i_hit]};
+      hit.reserveContribs(list.size);
+      for (int i_contrib{list.first}; i_contrib >= 0;
+           i_contrib = contribs_[i_contrib].next) {
+        const Contrib& contrib{contribs_[i_contrib]};
+        hit.addContrib(contrib.incident_id, contrib.track_id, contrib.pdg,
+                       contrib.edep, contrib.time);
+      }
+    }
+  }
+  std::sort(hits.begin(), hits.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.getID() < rhs.getID();
+  });
+}
+
+void EcalHitTable::clear() {
+  for (auto slot : touched_) slots_[slot].hit = -1;
+  touched_.clear();
+  for (auto slot : contrib_touched_) contrib_slots_[slot].contrib = -1;
+  contrib_touched_.clear();
+  contribs_.clear();
+  contrib_lists_.clear();
+  hits_.clear();
+}
+
+void EcalHitTable::growTable() {
+  std::vector<Slot> old_slots(std::max<std::size_t>(1024, 2 * slots_.size()));
+  slots_.swap(old_slots);
+  std::size_t mask{slots_.size() - 1};
+  for (auto& slot : touched_) {
+    const Slot& cell{old_slots[slot]};
+    slot = cellHash(cell.id) & mask;
+    while (slots_[slot].hit >= 0) slot = (slot + 1) & mask;
+    slots_[slot] = cell;
+  }
+}
+
+EcalHitTable::Contrib& EcalHitTable::newContrib(std::size_t hit, int track_id,
+                                                int pdg) {
+  int i_contrib{static_cast<int>(contribs_.size())};
+  ContribList& list{contrib_lists_[hit]};
+  if (list.last >= 0) {
+    contribs_[list.last].next = i_contrib;
+  } else {
+    list.first = i_contrib;
+  }
+  list.last = i_contrib;
+  list.size++;
+  return contribs_.emplace_back(Contrib{-1, track_id, pdg, 0., 0., -1});
+}
+
+EcalHitTable::Contrib& EcalHitTable::findContrib(std::size_t hit,
+                                                 int track_id, int pdg,
+                                                 bool& created) {
+  if (2 * (contribs_.size() + 1) > contrib_slots_.size()) growContribTable();
+
+  std::size_t mask{contrib_slots_.size() - 1};
+  std::size_t slot{contribHash(hit, track_id, pdg) & mask};
+  while (contrib_slots_[slot].contrib >= 0) {
+    const ContribSlot& entry{contrib_slots_[slot]};
+    if (entry.hit == hit and entry.track_id == track_id and entry.pdg == pdg) {
+      created = false;
+      return contribs_[entry.contrib];
+    }
+    slot = (slot + 1) & mask;
+  }
+
+  contrib_slots_[slot] = {hit, track_id, pdg,
+                          static_cast<int>(contribs_.size())};
+  contrib_touched_.push_back(slot);
+  created = true;
+  return newContrib(hit, track_id, pdg);
+}
+
+void EcalHitTable::growContribTable() {
+  std::vector<ContribSlot> old_slots(
+      std::max<std::size_t>(4096, 2 * contrib_slots_.size()));
+  contrib_slots_.swap(old_slots);
+  std::size_t mask{contrib_slots_.size() - 1};
+  for (auto& slot : contrib_touched_) {
+    const ContribSlot& entry{old_slots[slot]};
+    slot = contribHash(entry.hit, entry.track_id, entry.pdg) & mask;
+    while (contrib_slots_[slot].contrib >= 0) slot = (slot + 1) & mask;
+    contrib_slots_[slot] = entry;
+  }
+}
+
+}  // namespace simcore
@@ -18,15 +18,27 @@ const std::string EcalSD::COLLECTION_NAME = "EcalSimHits";
 
 EcalSD::EcalSD(const std::string& name, simcore::ConditionsInterface& ci,
                const framework::config::Parameters& p)
-    : SensitiveDetector(name, ci, p) {
-  enableHitContribs_ = p.getParameter<bool>("enableHitContribs");
-  compressHitContribs_ = p.getParameter<bool>("compressHitContribs");
+    : SensitiveDetector(name, ci, p),
+      hits_{p.getParameter<bool>("enableHitContribs"),
+            p.getParameter<bool>("compressHitContribs")} {
+  configureReadoutCuts(p);
+}
+
+void EcalSD::Initialize(G4HCofThisEvent* hce) {
+  SensitiveDetector::Initialize(hce);
+  geometry_ = nullptr;
+}
+
+const ldmx::EcalGeometry& EcalSD::getGeometry() {
+  if (not geometry_) {
+    geometry_ = &getCondition<ldmx::EcalGeometry>(
+        ldmx::EcalGeometry::CONDITIONS_OBJECT_NAME);
+  }
+  return *geometry_;
 }
 
 G4bool EcalSD::ProcessHits(G4Step* aStep, G4TouchableHistory*) {
   static const int layer_depth = 2;  // index depends on GDML implementation
-  const auto& geometry = getCondition<ldmx::EcalGeometry>(
-      ldmx::EcalGeometry::CONDITIONS_OBJECT_NAME);
 
   // Get the edep from the step.
   G4double edep = aStep->GetTotalEnergyDeposit();
@@ -40,6 +52,9 @@ G4bool EcalSD::ProcessHits(G4Step* aStep, G4TouchableHistory*) {
     return false;
   }
 
+  // Drop the step if it is outside of the readout window or below threshold
+  if (not passesReadoutCuts(aStep, edep)) return false;
+
   // Compute the hit position
   G4StepPoint* prePoint = aStep->GetPreStepPoint();
   G4StepPoint* postPoint = aStep->GetPostStepPoint();
@@ -47,11 +62,7 @@ G4bool EcalSD::ProcessHits(G4Step* aStep, G4TouchableHistory*) {
       0.5 * (prePoint->GetPosition() + postPoint->GetPosition());
 
   // Create the ID for the hit.
-  int cpynum = aStep->GetPreStepPoint()
-                   ->GetTouchableHandle()
-                   ->GetHistory()
-                   ->GetVolume(layer_depth)
-                   ->GetCopyNo();
+  int cpynum = getVolumeInfo(prePoint, layer_depth).copy_number;
   int layerNumber;
   layerNumber = cpynum / 7;
   int module_position = cpynum % 7;
@@ -66,6 +77,8 @@ G4bool EcalSD::ProcessHits(G4Step* aStep, G4TouchableHistory*) {
     << std::endl;
    */
 
+  const auto& geometry{getGeometry()};
+
   // fastest, but need to trust module number between GDML and EcalGeometry
   // match
   ldmx::EcalID id =
@@ -82,9 +95,10 @@ G4bool EcalSD::ProcessHits(G4Step* aStep, G4TouchableHistory*) {
   //    is inside of the configured SD volumes from Geant4's point of view
   // ldmx::EcalID id = geometry.getID(position[0], position[1], position[2]);
 
-  if (hits_.find(id) == hits_.end()) {
-    // hit in empty cell
-    auto& hit = hits_[id];
+  bool created{false};
+  std::size_t i_hit{hits_.findHit(id, created)};
+  if (created) {
+    auto& hit{hits_.getHit(i_hit)};
     hit.setID(id.raw());
     /**
      * convert position to center of cell position
@@ -99,39 +113,26 @@ G4bool EcalSD::ProcessHits(G4Step* aStep, G4TouchableHistory*) {
     hit.setPosition(x, y, z);
   }
 
-  auto& hit = hits_[id];
-
   // hit variables
   auto track = aStep->GetTrack();
   auto time = track->GetGlobalTime();
   auto track_id = track->GetTrackID();
   auto pdg = track->GetParticleDefinition()->GetPDGEncoding();
 
-  if (enableHitContribs_) {
-    int contrib_i = hit.findContribIndex(track_id, pdg);
-    if (compressHitContribs_ and contrib_i != -1) {
-      hit.updateContrib(contrib_i, edep, time);
-    } else {
-      hit.addContrib(getTrackMap().findIncident(track_id), track_id, pdg, edep,
-                     time);
-    }
-  } else {
-    // no hit contribs and hit already exists
-    hit.setEdep(hit.getEdep() + edep);
-    if (time < hit.getTime() or hit.getTime() == 0) {
-      hit.setTime(time);
-    }
-  }
+  hits_.addStep(i_hit, getTrackMap().findIncident(track_id), track_id, pdg,
+                edep, time);
 
   return true;
 }
 
+void EcalSD::prepareHits() {
+  // squash hits into list, sorted by ID like they were when they were
+  // kept in a map
+  hits_.stage(staged_hits_);
+}
+
 void EcalSD::saveHits(framework::Event& event) {
-  // squash hits into list
-  std::vector<ldmx::SimCalorimeterHit> hits;
-  hits.reserve(hits_.size());
-  for (const auto& [id, hit] : hits_) hits.push_back(hit);
-  event.add(COLLECTION_NAME, hits);
+  event.add(COLLECTION_NAME, staged_hits_);
 }
 
 }  // namespace simcore
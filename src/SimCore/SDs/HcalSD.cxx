@@ -7,10 +7,10 @@
 #include "DetDescr/HcalID.h"
 
 // STL
+#include <cmath>
 #include <iostream>
 
 // Geant4
-#include "G4Box.hh"
 #include "G4ParticleTypes.hh"
 #include "G4Step.hh"
 #include "G4StepPoint.hh"
@@ -24,19 +24,35 @@ HcalSD::HcalSD(const std::string& name, simcore::ConditionsInterface& ci,
     : SensitiveDetector(name, ci, p), birksc1_(1.29e-2), birksc2_(9.59e-6) {
   gdmlIdentifiers_ = {
       p.getParameter<std::vector<std::string>>("gdml_identifiers")};
+  merge_steps_ = p.getParameter<bool>("merge_steps", false);
+  merge_per_track_ = p.getParameter<bool>("merge_per_track", false);
+  merge_time_bin_ = p.getParameter<double>("merge_time_bin", 0.);
+  configureReadoutCuts(p);
+}
+
+void HcalSD::Initialize(G4HCofThisEvent* hce) {
+  SensitiveDetector::Initialize(hce);
+  geometry_ = nullptr;
+}
+
+const ldmx::HcalGeometry& HcalSD::getGeometry() {
+  if (not geometry_) {
+    geometry_ = &getCondition<ldmx::HcalGeometry>(
+        ldmx::HcalGeometry::CONDITIONS_OBJECT_NAME);
+  }
+  return *geometry_;
 }
 
 ldmx::HcalID HcalSD::decodeCopyNumber(const std::uint32_t copyNumber,
                                       const G4ThreeVector& localPosition,
-                                      const G4Box* scint) {
+                                      const G4ThreeVector& halfLengths) {
   const unsigned int version{copyNumber / 0x01000000};
   if (version != 0) {
     using Index = ldmx::PackedIndex<256, 256, 256>;
     return ldmx::HcalID{Index(copyNumber).field2(), Index(copyNumber).field1(),
                         Index(copyNumber).field0()};
   }
-  const auto& geometry = getCondition<ldmx::HcalGeometry>(
-      ldmx::HcalGeometry::CONDITIONS_OBJECT_NAME);
+  const auto& geometry{getGeometry()};
   unsigned int stripID = 0;
   const unsigned int section = copyNumber / 1000;
   const unsigned int layer = copyNumber % 1000;
@@ -44,12 +60,12 @@ ldmx::HcalID HcalSD::decodeCopyNumber(const std::uint32_t copyNumber,
   // 5cm wide bars are HARD-CODED
   if (section == ldmx::HcalID::BACK) {
     if (geometry.backLayerIsHorizontal(layer)) {
-      stripID = int((localPosition.y() + scint->GetYHalfLength()) / 50.0);
+      stripID = int((localPosition.y() + halfLengths.y()) / 50.0);
     } else {
-      stripID = int((localPosition.x() + scint->GetXHalfLength()) / 50.0);
+      stripID = int((localPosition.x() + halfLengths.x()) / 50.0);
     }
   } else {
-    stripID = int((localPosition.z() + scint->GetZHalfLength()) / 50.0);
+    stripID = int((localPosition.z() + halfLengths.z()) / 50.0);
   }
   return ldmx::HcalID{section, layer, stripID};
 }
@@ -67,6 +83,17 @@ G4bool HcalSD::ProcessHits(G4Step* aStep, G4TouchableHistory* ROhist) {
     return false;
   }
 
+  // Set the step mid-point as the hit position.
+  G4StepPoint* prePoint = aStep->GetPreStepPoint();
+  G4StepPoint* postPoint = aStep->GetPostStepPoint();
+
+  // The scintillator bar the step is in. Note 2 here corresponds to the
+  // "depth" of the geometry tree the copy number is read from. If this
+  // changes in the GDML, this would have to be updated here. Currently, 0
+  // corresponds to the world volume, 1 corresponds to the Hcal, and 2 to
+  // the bars/absorbers
+  const VolumeInfo& bar{getVolumeInfo(prePoint, 2)};
+
   //---------------------------------------------------------------------------------------------------
   //                Birks' Law
   //                ===========
@@ -100,8 +127,7 @@ G4bool HcalSD::ProcessHits(G4Step* aStep, G4TouchableHistory* ROhist) {
   // Do not apply Birks for gamma deposits!
   if (stepLength > 1.0e-6)  // Check, cut if necessary.
   {
-    G4double rho = aStep->GetPreStepPoint()->GetMaterial()->GetDensity() /
-                   (CLHEP::g / CLHEP::cm3);
+    G4double rho = bar.density / (CLHEP::g / CLHEP::cm3);
     G4double dedx = edep / (rho * stepLength);  //[MeV*cm^2/g]
     birksFactor = 1.0 / (1.0 + birksc1_ * dedx + birksc2_ * dedx * dedx);
     if (aStep->GetTrack()->GetDefinition() == G4Gamma::GammaDefinition())
@@ -113,42 +139,54 @@ G4bool HcalSD::ProcessHits(G4Step* aStep, G4TouchableHistory* ROhist) {
   // update edep to include birksFactor
   edep *= birksFactor;
 
-  // Create a new cal hit.
-  ldmx::SimCalorimeterHit& hit{hits_.emplace_back()};
+  // Drop the step if it is outside of the readout window or below threshold
+  if (not passesReadoutCuts(aStep, edep)) return false;
 
-  // Get the scintillator solid box
-  G4Box* scint = static_cast<G4Box*>(aStep->GetPreStepPoint()
-                                         ->GetTouchableHandle()
-                                         ->GetVolume()
-                                         ->GetLogicalVolume()
-                                         ->GetSolid());
-
-  // Set the step mid-point as the hit position.
-  G4StepPoint* prePoint = aStep->GetPreStepPoint();
-  G4StepPoint* postPoint = aStep->GetPostStepPoint();
-  // A Geant4 "touchable" is a way to uniquely identify a particular volume,
-  // short for touchable detector element. See the detector definition and
-  // response section of the Geant4 application developers manual for details.
-  //
-  // The TouchableHandle is just a reference counted pointer to a
-  // G4TouchableHistory object, which is a concrete implementation of a
-  // G4Touchable interface.
-  //
-  auto touchableHistory{prePoint->GetTouchableHandle()->GetHistory()};
   // Affine transform for converting between local and global coordinates
-  auto topTransform{touchableHistory->GetTopTransform()};
+  const G4AffineTransform& topTransform{bar.to_local};
   G4ThreeVector position =
       0.5 * (prePoint->GetPosition() + postPoint->GetPosition());
   G4ThreeVector localPosition = topTransform.TransformPoint(position);
-  hit.setPosition(position[0], position[1], position[2]);
 
-  // Create the ID for the hit. Note 2 here corresponds to the "depth" of the
-  // geometry tree. If this changes in the GDML, this would have to be updated
-  // here. Currently, 0 corresponds to the world volume, 1 corresponds to the
-  // Hcal, and 2 to the bars/absorbers
-  int copyNum = touchableHistory->GetVolume(2)->GetCopyNo();
-  ldmx::HcalID id = decodeCopyNumber(copyNum, localPosition, scint);
-  hit.setID(id.raw());
+  // Create the ID for the hit.
+  ldmx::HcalID id =
+      decodeCopyNumber(bar.copy_number, localPosition, bar.half_lengths);
+
+  const G4Track* track = aStep->GetTrack();
+  int track_id = track->GetTrackID();
+  int pdg = track->GetParticleDefinition()->GetPDGEncoding();
+  double time = track->GetGlobalTime();
+
+  // Create a new cal hit, unless this step is merged into an existing one.
+  bool new_hit{true};
+  std::size_t i_hit{hits_.size()};
+  if (merge_steps_) {
+    MergeKey key{id.raw(), merge_per_track_ ? track_id : 0,
+                 merge_time_bin_ > 0
+                     ? static_cast<long>(std::floor(time / merge_time_bin_))
+                     : 0};
+    auto [merged, inserted] = merged_.try_emplace(key, hits_.size());
+    new_hit = inserted;
+    i_hit = merged->second;
+  }
+  if (new_hit) hits_.emplace_back();
+  ldmx::SimCalorimeterHit& hit{hits_[i_hit]};
+
+  if (new_hit) {
+    hit.setPosition(position[0], position[1], position[2]);
+    hit.setID(id.raw());
+  } else {
+    // the position of a merged hit is the energy-weighted mean of the
+    // mid-points of its steps
+    double total_edep{hit.getEdep() + edep};
+    if (total_edep > 0) {
+      auto hit_position{hit.getPosition()};
+      double w{edep / total_edep};
+      hit.setPosition(hit_position[0] + w * (position[0] - hit_position[0]),
+                      hit_position[1] + w * (position[1] - hit_position[1]),
+                      hit_position[2] + w * (position[2] - hit_position[2]));
+    }
+  }
 
   // add one contributor for this hit with
   //  ID of ancestor incident on Cal-Region
@@ -156,41 +194,51 @@ G4bool HcalSD::ProcessHits(G4Step* aStep, G4TouchableHistory* ROhist) {
   //  PDG of this track
   //  EDEP (including birks factor)
   //  time of this hit
-  const G4Track* track = aStep->GetTrack();
-  int track_id = track->GetTrackID();
-  hit.addContrib(getTrackMap().findIncident(track_id), track_id,
-                 track->GetParticleDefinition()->GetPDGEncoding(), edep,
-                 track->GetGlobalTime());
+  // a merged hit has one contributor per track and PDG
+  int contrib_i{new_hit ? -1 : hit.findContribIndex(track_id, pdg)};
+  if (contrib_i != -1) {
+    hit.updateContrib(contrib_i, edep, time);
+  } else {
+    hit.addContrib(getTrackMap().findIncident(track_id), track_id, pdg, edep,
+                   time);
+  }
   //
   // Pre/post step details for scintillator response simulation
 
-  // Convert back to mm
-  hit.setPathLength(stepLength * CLHEP::cm / CLHEP::mm);
-  hit.setVelocity(track->GetVelocity());
-  const auto& geometry = getCondition<ldmx::HcalGeometry>(
-      ldmx::HcalGeometry::CONDITIONS_OBJECT_NAME);
+  // Convert back to mm, a merged hit has the total path length of its steps
+  double pathLength{stepLength * CLHEP::cm / CLHEP::mm};
+  hit.setPathLength(new_hit ? pathLength : hit.getPathLength() + pathLength);
+  const auto& geometry{getGeometry()};
   // Convert pre/post step position from global coordinates to coordinates
   // within the scintillator bar
-  const auto localPreStepPoint{
-      topTransform.TransformPoint(prePoint->GetPosition())};
-  const auto localPostStepPoint{
-      topTransform.TransformPoint(postPoint->GetPosition())};
-
   // And rotate them to a local coordinate system for the bar that always has
   // the same x/y/z definitions (see HcalGeometry for details)
-  auto localPrePositionRotated{geometry.rotateGlobalToLocalBarPosition(
-      {localPreStepPoint[0], localPreStepPoint[1], localPreStepPoint[2]}, id)};
-
-  auto localPostPositionRotated{geometry.rotateGlobalToLocalBarPosition(
-      {localPostStepPoint[0], localPostStepPoint[1], localPostStepPoint[2]},
-      id)};
-  hit.setPreStepPosition(localPrePositionRotated[0], localPrePositionRotated[1],
-                         localPrePositionRotated[2]);
-  hit.setPostStepPosition(localPostPositionRotated[0],
-                          localPostPositionRotated[1],
-                          localPostPositionRotated[2]);
-  hit.setPreStepTime(prePoint->GetGlobalTime());
-  hit.setPostStepTime(postPoint->GetGlobalTime());
+  // a merged hit keeps the pre-step details of its earliest step and the
+  // post-step details of its latest step, whichever tracks took them
+  if (new_hit or prePoint->GetGlobalTime() < hit.getPreStepTime()) {
+    hit.setVelocity(track->GetVelocity());
+    const auto localPreStepPoint{
+        topTransform.TransformPoint(prePoint->GetPosition())};
+    auto localPrePositionRotated{geometry.rotateGlobalToLocalBarPosition(
+        {localPreStepPoint[0], localPreStepPoint[1], localPreStepPoint[2]},
+        id)};
+    hit.setPreStepPosition(localPrePositionRotated[0],
+                           localPrePositionRotated[1],
+                           localPrePositionRotated[2]);
+    hit.setPreStepTime(prePoint->GetGlobalTime());
+  }
+
+  if (new_hit or postPoint->GetGlobalTime() > hit.getPostStepTime()) {
+    const auto localPostStepPoint{
+        topTransform.TransformPoint(postPoint->GetPosition())};
+    auto localPostPositionRotated{geometry.rotateGlobalToLocalBarPosition(
+        {localPostStepPoint[0], localPostStepPoint[1], localPostStepPoint[2]},
+        id)};
+    hit.setPostStepPosition(localPostPositionRotated[0],
+                            localPostPositionRotated[1],
+                            localPostPositionRotated[2]);
+    hit.setPostStepTime(postPoint->GetGlobalTime());
+  }
 
   if (this->verboseLevel > 2) {
     hit.Print();
@@ -6,11 +6,13 @@
 /*----------------*/
 /*   C++ StdLib   */
 /*----------------*/
+#include <algorithm>
 #include <iostream>
 
 /*~~~~~~~~~~~~*/
 /*   Geant4   */
 /*~~~~~~~~~~~~*/
+#include "G4Box.hh"
 #include "G4ChargedGeantino.hh"
 #include "G4Geantino.hh"
 #include "G4SDManager.hh"
@@ -25,9 +27,65 @@ ScoringPlaneSD::ScoringPlaneSD(const std::string& name,
     : SensitiveDetector(name, ci, params) {
   collection_name_ = params.getParameter<std::string>("collection_name");
   match_substr_ = params.getParameter<std::string>("match_substr");
+  pdg_ids_ = params.getParameter<std::vector<int>>("pdg_ids", {});
+  min_energy_ = params.getParameter<double>("min_energy", 0.);
+  direction_ = params.getParameter<int>("direction", 0);
+  configureReadoutWindow(params);
+  first_step_only_ = params.getParameter<bool>("first_step_only", false);
+}
+
+G4ThreeVector ScoringPlaneSD::getNormal(const G4StepPoint* point) {
+  const G4VSolid* solid{
+      point->GetPhysicalVolume()->GetLogicalVolume()->GetSolid()};
+  auto cached{normals_.find(solid)};
+  if (cached == normals_.end()) {
+    G4ThreeVector local_normal{0., 0., 1.};
+    if (auto box{dynamic_cast<const G4Box*>(solid)}) {
+      double x{box->GetXHalfLength()}, y{box->GetYHalfLength()},
+          z{box->GetZHalfLength()};
+      if (x <= y and x <= z) {
+        local_normal = {1., 0., 0.};
+      } else if (y <= z) {
+        local_normal = {0., 1., 0.};
+      }
+    }
+    cached = normals_.emplace(solid, local_normal).first;
+  }
+  // the top transform goes from global to local coordinates
+  return point->GetTouchableHandle()
+      ->GetHistory()
+      ->GetTopTransform()
+      .InverseTransformAxis(cached->second);
 }
 
 G4bool ScoringPlaneSD::ProcessHits(G4Step* step, G4TouchableHistory* history) {
+  const G4Track* track{step->GetTrack()};
+  G4StepPoint* prePoint = step->GetPreStepPoint();
+
+  // Apply the filters, cheapest first, before creating the hit
+  if (not pdg_ids_.empty() and
+      std::find(pdg_ids_.begin(), pdg_ids_.end(),
+                track->GetDynamicParticle()->GetPDGcode()) == pdg_ids_.end()) {
+    return false;
+  }
+  if (prePoint->GetKineticEnergy() < min_energy_) return false;
+  if (not inReadoutWindow(step)) return false;
+  if (first_step_only_ and prePoint->GetStepStatus() != fGeomBoundary) {
+    return false;
+  }
+  if (direction_ != 0 and
+      direction_ * prePoint->GetMomentumDirection().dot(getNormal(prePoint)) <=
+          0) {
+    return false;
+  }
+  int cpNumber = prePoint->GetTouchableHandle()->GetCopyNumber();
+  if (first_step_only_) {
+    std::uint64_t crossing{
+        (static_cast<std::uint64_t>(track->GetTrackID()) << 32) |
+        static_cast<std::uint32_t>(cpNumber)};
+    if (not crossed_.insert(crossing).second) return false;
+  }
+
   // Get the edep from the step.
   G4double edep = step->GetTotalEnergyDeposit();
 
@@ -41,9 +99,6 @@ G4bool ScoringPlaneSD::ProcessHits(G4Step* step, G4TouchableHistory* history) {
   // Set the edep.
   hit.setEdep(edep);
 
-  // Set the start position.
-  G4StepPoint* prePoint = step->GetPreStepPoint();
-
   // Set the end position.
   G4StepPoint* postPoint = step->GetPostStepPoint();
 
@@ -71,7 +126,6 @@ G4bool ScoringPlaneSD::ProcessHits(G4Step* step, G4TouchableHistory* history) {
   /*
    * Set the 32-bit ID on the hit.
    */
-  int cpNumber = prePoint->GetTouchableHandle()->GetCopyNumber();
   ldmx::SimSpecialID id = ldmx::SimSpecialID::ScoringPlaneID(cpNumber);
   hit.setID(id.raw());
 
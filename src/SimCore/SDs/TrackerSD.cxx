@@ -15,6 +15,7 @@ TrackerSD::TrackerSD(const std::string& name, simcore::ConditionsInterface& ci,
   collection_name_ = p.getParameter<std::string>("collection_name");
 
   subDetID_ = ldmx::SubdetectorIDType(p.getParameter<int>("subdet_id"));
+  merge_steps_ = p.getParameter<bool>("merge_steps", false);
 }
 
 G4bool TrackerSD::ProcessHits(G4Step* aStep, G4TouchableHistory*) {
@@ -30,15 +31,6 @@ G4bool TrackerSD::ProcessHits(G4Step* aStep, G4TouchableHistory*) {
     return false;
   }
 
-  // Create a new hit object.
-  ldmx::SimTrackerHit& hit{hits_.emplace_back()};
-
-  // Assign track ID for finding the SimParticle in post event processing.
-  hit.setTrackID(aStep->GetTrack()->GetTrackID());
-
-  // Set the edep.
-  hit.setEdep(edep);
-
   // Set the start position.
   G4StepPoint* prePoint = aStep->GetPreStepPoint();
   // hit->setStartPosition(prePoint->GetPosition());
@@ -50,14 +42,55 @@ G4bool TrackerSD::ProcessHits(G4Step* aStep, G4TouchableHistory*) {
   G4ThreeVector start = prePoint->GetPosition();
   G4ThreeVector end = postPoint->GetPosition();
 
-  // Set the mid position.
-  G4ThreeVector mid = 0.5 * (start + end);
-  hit.setPosition(mid.x(), mid.y(), mid.z());
-
   // Compute path length.
   G4double pathLength =
       sqrt(pow(start.x() - end.x(), 2) + pow(start.y() - end.y(), 2) +
            pow(start.z() - end.z(), 2));
+
+  /*
+   * Get the 32-bit ID of the sensor.
+   */
+  int copyNum = getVolumeInfo(prePoint, 2).copy_number;
+  int layer = copyNum / 10;
+  int module = copyNum % 10;
+  ldmx::TrackerID id(subDetID_, layer, module);
+
+  int track_id{aStep->GetTrack()->GetTrackID()};
+
+  /*
+   * Merge this step into the last hit if it continues the last step of
+   * the same track in the same sensor. The merged hit spans from where the
+   * track entered the sensor to the end of this step and keeps the time,
+   * momentum and energy of its first step.
+   */
+  if (merge_steps_ and track_id == last_track_id_ and
+      id.raw() == last_id_ and start == last_exit_) {
+    ldmx::SimTrackerHit& hit{hits_.back()};
+    hit.setEdep(hit.getEdep() + edep);
+    G4ThreeVector mid = 0.5 * (last_entry_ + end);
+    hit.setPosition(mid.x(), mid.y(), mid.z());
+    hit.setPathLength(hit.getPathLength() + pathLength);
+    last_exit_ = end;
+    return true;
+  }
+
+  // Create a new hit object.
+  ldmx::SimTrackerHit& hit{hits_.emplace_back()};
+  last_track_id_ = track_id;
+  last_id_ = id.raw();
+  last_entry_ = start;
+  last_exit_ = end;
+
+  // Assign track ID for finding the SimParticle in post event processing.
+  hit.setTrackID(track_id);
+
+  // Set the edep.
+  hit.setEdep(edep);
+
+  // Set the mid position.
+  G4ThreeVector mid = 0.5 * (start + end);
+  hit.setPosition(mid.x(), mid.y(), mid.z());
+
   hit.setPathLength(pathLength);
 
   // Set the global time.
@@ -72,11 +105,6 @@ G4bool TrackerSD::ProcessHits(G4Step* aStep, G4TouchableHistory*) {
   /*
    * Set the 32-bit ID on the hit.
    */
-  int copyNum =
-      prePoint->GetTouchableHandle()->GetHistory()->GetVolume(2)->GetCopyNo();
-  int layer = copyNum / 10;
-  int module = copyNum % 10;
-  ldmx::TrackerID id(subDetID_, layer, module);
   hit.setID(id.raw());
   hit.setLayerID(layer);
   hit.setModuleID(module);
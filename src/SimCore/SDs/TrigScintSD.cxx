@@ -20,6 +20,8 @@ TrigScintSD::TrigScintSD(const std::string& name,
   module_id_ = p.getParameter<int>("module_id");
   collection_name_ = p.getParameter<std::string>("collection_name");
   vol_name_ = p.getParameter<std::string>("volume_name");
+  merge_steps_ = p.getParameter<bool>("merge_steps", false);
+  configureReadoutCuts(p);
 }
 
 G4bool TrigScintSD::ProcessHits(G4Step* step, G4TouchableHistory* history) {
@@ -30,39 +32,57 @@ G4bool TrigScintSD::ProcessHits(G4Step* step, G4TouchableHistory* history) {
   // skip processing it.
   if (energy == 0 and not isGeantino(step)) return false;
 
-  // Create a new instance of a calorimeter hit
-  //  emplace_back returns a *reference* to the hit that was constructed
-  //  and we should keep that reference so that we are editing the correct hit
-  ldmx::SimCalorimeterHit& hit = hits_.emplace_back();
+  // Drop the step if it is outside of the readout window or below threshold
+  if (not passesReadoutCuts(step, energy)) return false;
 
   G4StepPoint* prePoint = step->GetPreStepPoint();
   G4StepPoint* postPoint = step->GetPostStepPoint();
 
-  // A Geant4 "touchable" is a way to uniquely identify a particular volume,
-  // short for touchable detector element. See the detector definition and
-  // response section of the Geant4 application developers manual for details.
-  //
-  // The TouchableHandle is just a reference counted pointer to a
-  // G4TouchableHistory object, which is a concrete implementation of a
-  // G4Touchable interface.
-  //
-  auto touchableHistory{prePoint->GetTouchableHandle()->GetHistory()};
-  // Affine transform for converting between local and global coordinates
-  auto topTransform{touchableHistory->GetTopTransform()};
+  // The bar, whose center and copy number are worked out from the
+  // touchable the first time the bar is stepped in
+  const VolumeInfo& bar{
+      getVolumeInfo(prePoint, prePoint->GetTouchable()->GetHistoryDepth())};
+
   // Set the hit position
   auto position{0.5 * (prePoint->GetPosition() + postPoint->GetPosition())};
 
-  // Convert the center of the bar to its corresponding global position
-  auto volumePosition{topTransform.Inverse().TransformPoint(G4ThreeVector())};
-  hit.setPosition(position[0], position[1], volumePosition.z());
-
   // Get the track associated with this step
   auto track{step->GetTrack()};
-
-  // Set the ID on the hit.
-  auto bar{track->GetVolume()->GetCopyNo()};
-  ldmx::TrigScintID id(module_id_, bar);
-  hit.setID(id.raw());
+  auto track_id{track->GetTrackID()};
+  auto pdg{track->GetParticleDefinition()->GetPDGEncoding()};
+
+  // The ID of the hit
+  ldmx::TrigScintID id(module_id_, bar.copy_number);
+
+  // Create a new instance of a calorimeter hit, unless this step is merged
+  // into the hit already in this bar
+  bool new_hit{true};
+  std::size_t i_hit{hits_.size()};
+  if (merge_steps_) {
+    auto [merged, inserted] = merged_.try_emplace(id.raw(), hits_.size());
+    new_hit = inserted;
+    i_hit = merged->second;
+  }
+  if (new_hit) hits_.emplace_back();
+  //  keep a *reference* to the hit so that we are editing the correct hit
+  ldmx::SimCalorimeterHit& hit = hits_[i_hit];
+
+  if (new_hit) {
+    hit.setPosition(position[0], position[1], bar.center.z());
+    // Set the ID on the hit.
+    hit.setID(id.raw());
+  } else {
+    // the transverse position of a merged hit is the energy-weighted mean
+    // of the mid-points of its steps
+    double total_energy{hit.getEdep() + energy};
+    if (total_energy > 0) {
+      auto hit_position{hit.getPosition()};
+      double w{energy / total_energy};
+      hit.setPosition(hit_position[0] + w * (position[0] - hit_position[0]),
+                      hit_position[1] + w * (position[1] - hit_position[1]),
+                      bar.center.z());
+    }
+  }
 
   // add single contrib to this calorimeter hit
   //  IncidentID - this track's ID
@@ -70,27 +90,38 @@ G4bool TrigScintSD::ProcessHits(G4Step* step, G4TouchableHistory* history) {
   //  PDG ID
   //  energy deposited
   //  global time of this hit
-  hit.addContrib(track->GetTrackID(), track->GetTrackID(),
-                 track->GetParticleDefinition()->GetPDGEncoding(), energy,
-                 track->GetGlobalTime());
+  // a merged hit has one contributor per track and PDG
+  int contrib_i{new_hit ? -1 : hit.findContribIndex(track_id, pdg)};
+  if (contrib_i != -1) {
+    hit.updateContrib(contrib_i, energy, track->GetGlobalTime());
+  } else {
+    hit.addContrib(track_id, track_id, pdg, energy, track->GetGlobalTime());
+  }
 
   // Step details
-  hit.setPathLength(step->GetStepLength());
-  hit.setVelocity(track->GetVelocity());
+  //  a merged hit has the total path length of its steps, the pre-step
+  //  details of its earliest step and the post-step details of its latest
+  //  step, whichever tracks took them
+  hit.setPathLength(new_hit ? step->GetStepLength()
+                            : hit.getPathLength() + step->GetStepLength());
   // Convert pre/post step position from global coordinates to coordinates
   // within the scintillator bar
-  const auto localPreStepPoint{
-      topTransform.TransformPoint(prePoint->GetPosition())};
-  const auto localPostStepPoint{
-      topTransform.TransformPoint(postPoint->GetPosition())};
-  hit.setPreStepPosition(localPreStepPoint[0], localPreStepPoint[1],
-                         localPreStepPoint[2]);
-
-  hit.setPostStepPosition(localPostStepPoint[0], localPostStepPoint[1],
-                          localPostStepPoint[2]);
-
-  hit.setPreStepTime(prePoint->GetGlobalTime());
-  hit.setPostStepTime(postPoint->GetGlobalTime());
+  if (new_hit or prePoint->GetGlobalTime() < hit.getPreStepTime()) {
+    hit.setVelocity(track->GetVelocity());
+    const auto localPreStepPoint{
+        bar.to_local.TransformPoint(prePoint->GetPosition())};
+    hit.setPreStepPosition(localPreStepPoint[0], localPreStepPoint[1],
+                           localPreStepPoint[2]);
+    hit.setPreStepTime(prePoint->GetGlobalTime());
+  }
+
+  if (new_hit or postPoint->GetGlobalTime() > hit.getPostStepTime()) {
+    const auto localPostStepPoint{
+        bar.to_local.TransformPoint(postPoint->GetPosition())};
+    hit.setPostStepPosition(localPostStepPoint[0], localPostStepPoint[1],
+                            localPostStepPoint[2]);
+    hit.setPostStepTime(postPoint->GetGlobalTime());
+  }
 
   return true;
 }
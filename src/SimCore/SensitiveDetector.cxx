@@ -1,10 +1,19 @@
 #include "SimCore/SensitiveDetector.h"
 
+#include <cmath>
+#include <limits>
+
 #include "Framework/Exception/Exception.h"
+#include "G4Box.hh"
 #include "G4ChargedGeantino.hh"
 #include "G4Geantino.hh"
+#include "G4Material.hh"
+#include "G4NavigationHistory.hh"
 #include "G4SDManager.hh"
 #include "G4Step.hh"
+#include "G4StepPoint.hh"
+#include "G4VPhysicalVolume.hh"
+#include "G4VTouchable.hh"
 
 namespace simcore {
 
@@ -16,10 +25,76 @@ SensitiveDetector::SensitiveDetector(
   G4SDManager::GetSDMpointer()->AddNewDetector(this);
 }
 
+void SensitiveDetector::configureReadoutWindow(
+    const framework::config::Parameters& parameters) {
+  min_time_ = parameters.getParameter<double>(
+      "min_time", -std::numeric_limits<double>::infinity());
+  max_time_ = parameters.getParameter<double>(
+      "max_time", std::numeric_limits<double>::infinity());
+}
+
+void SensitiveDetector::configureReadoutCuts(
+    const framework::config::Parameters& parameters) {
+  configureReadoutWindow(parameters);
+  min_edep_ = parameters.getParameter<double>("min_edep", 0.);
+  has_readout_cuts_ = std::isfinite(min_time_) or std::isfinite(max_time_) or
+                      min_edep_ > 0.;
+}
+
+bool SensitiveDetector::inReadoutWindow(const G4Step* step) const {
+  double time{step->GetTrack()->GetGlobalTime()};
+  return time >= min_time_ and time <= max_time_;
+}
+
+bool SensitiveDetector::passesReadoutCuts(const G4Step* step, double edep) {
+  // geantinos never deposit energy, so they are only held to the window
+  if (not inReadoutWindow(step) or
+      (edep < min_edep_ and not isGeantino(step))) {
+    dropped_edep_ += edep;
+    return false;
+  }
+  return true;
+}
+
 bool SensitiveDetector::isGeantino(const G4Step* step) const {
   auto particle_def{step->GetTrack()->GetDefinition()};
   return (particle_def == G4Geantino::Definition() or
           particle_def == G4ChargedGeantino::Definition());
 }
 
+const SensitiveDetector::VolumeInfo& SensitiveDetector::getVolumeInfo(
+    const G4StepPoint* point, int copy_depth) {
+  const G4VTouchable* touchable{point->GetTouchable()};
+  VolumeKey key{point->GetPhysicalVolume(), touchable->GetReplicaNumber()};
+  if (last_volume_info_ and key == last_volume_) return *last_volume_info_;
+
+  auto [entry, inserted] = volume_cache_.try_emplace(key);
+  VolumeInfo& info{entry->second};
+  if (inserted) {
+    const G4NavigationHistory* history{touchable->GetHistory()};
+    if (copy_depth < 0 or copy_depth > static_cast<int>(history->GetDepth())) {
+      volume_cache_.erase(entry);
+      EXCEPTION_RAISE("SDGeometry",
+                      "Copy number at depth " + std::to_string(copy_depth) +
+                          " requested by '" + GetName() +
+                          "' but the volume '" +
+                          history->GetTopVolume()->GetName() +
+                          "' is at depth " +
+                          std::to_string(history->GetDepth()) + ".");
+    }
+    info.copy_number = history->GetVolume(copy_depth)->GetCopyNo();
+    if (auto box{dynamic_cast<const G4Box*>(touchable->GetSolid())}) {
+      info.half_lengths = G4ThreeVector(
+          box->GetXHalfLength(), box->GetYHalfLength(), box->GetZHalfLength());
+    }
+    info.density = point->GetMaterial()->GetDensity();
+    info.to_local = history->GetTopTransform();
+    info.center = info.to_local.Inverse().TransformPoint(G4ThreeVector());
+  }
+
+  last_volume_ = key;
+  last_volume_info_ = &info;
+  return info;
+}
+
 }  // namespace simcore
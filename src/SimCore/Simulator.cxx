@@ -20,11 +20,13 @@
 /*~~~~~~~~~~~~~*/
 #include "SimCore/APrimePhysics.h"
 #include "SimCore/DetectorConstruction.h"
+#include "SimCore/EventSeeds.h"
 #include "SimCore/G4Session.h"
 #include "SimCore/G4User/TrackingAction.h"
 #include "SimCore/Geo/ParserFactory.h"
 #include "SimCore/PrimaryGenerator.h"
 #include "SimCore/SensitiveDetector.h"
+#include "SimCore/StartupTimers.h"
 #include "SimCore/UserEventInformation.h"
 #include "SimCore/XsecBiasingOperator.h"
 
@@ -63,6 +65,7 @@ void Simulator::beforeNewRun(ldmx::RunHeader& header) {
   header.setIntParameter(
       "Use Random Seed from Event Header",
       parameters_.getParameter<bool>("rootPrimaryGenUseSeed"));
+  header.setIntParameter(COMPACT_EVENT_SEEDS_PARAMETER, compactEventSeeds_);
 
   // lambda function for dumping 3-vectors into the run header
   auto threeVectorDump = [&header](const std::string& name,
@@ -114,6 +117,10 @@ void Simulator::beforeNewRun(ldmx::RunHeader& header) {
   }
 
   header.setStringParameter("ldmx-sw revision", GIT_SHA1);
+
+  // Record where the time was spent while starting up
+  StartupTimers::getInstance().recordConfig(header);
+  if (verbosity_ > 0) StartupTimers::getInstance().print(std::cout);
 }
 
 void Simulator::onNewRun(const ldmx::RunHeader& runHeader) {
@@ -124,6 +131,7 @@ void Simulator::onNewRun(const ldmx::RunHeader& runHeader) {
   seeds.push_back(rseed.getSeed("Simulator[0]"));
   seeds.push_back(rseed.getSeed("Simulator[1]"));
   setSeeds(seeds);
+  runSeeds_ = seeds;
 
   run_ = runHeader.getRunNumber();
 }
@@ -131,10 +139,19 @@ void Simulator::onNewRun(const ldmx::RunHeader& runHeader) {
 void Simulator::produce(framework::Event& event) {
   // Generate and process a Geant4 event.
   numEventsBegan_++;
-  // Save the state of the random engine to an output stream. A string
-  // is then extracted and saved to the event header.
+  // Record how the random engine was set up for this event so that it can
+  // be resimulated. Either reseed the engine from a compact key or save
+  // its full state to an output stream (a string of which is then saved
+  // to the event header).
+  std::vector<int> event_seeds;
   std::ostringstream stream;
-  G4Random::saveFullState(stream);
+  if (compactEventSeeds_) {
+    event_seeds = deriveEventSeeds(runSeeds_, run_,
+                                   event.getEventHeader().getEventNumber());
+    setSeeds(event_seeds);
+  } else {
+    G4Random::saveFullState(stream);
+  }
   runManager_->ProcessOneEvent(event.getEventHeader().getEventNumber());
 
   // If a Geant4 event has been aborted, skip the rest of the processing
@@ -155,14 +172,19 @@ void Simulator::produce(framework::Event& event) {
   auto& event_header = event.getEventHeader();
   updateEventHeader(event_header);
 
-  event_header.setStringParameter("eventSeed", stream.str());
+  if (compactEventSeeds_) {
+    event_header.setIntParameter("eventSeed0", event_seeds.at(0));
+    event_header.setIntParameter("eventSeed1", event_seeds.at(1));
+  } else {
+    event_header.setStringParameter("eventSeed", stream.str());
+  }
+
+  terminateEvent();
 
   saveTracks(event);
 
   saveSDHits(event);
 
-  runManager_->TerminateOneEvent();
-
   return;
 }
 
@@ -180,33 +202,6 @@ void Simulator::onProcessEnd() {
             << numEventsCompleted_ << " events." << std::endl;
 }
 
-void Simulator::setSeeds(std::vector<int> seeds) {
-  // If no seeds have been specified then return immediately.
-  if (seeds.empty()) {
-    return;
-  }
-
-  // If seeds are specified, make sure that the container has at least
-  // two seeds.  If not, throw an exception.
-  if (seeds.size() == 1) {
-    EXCEPTION_RAISE("ConfigurationException",
-                    "At least two seeds need to be specified.");
-  }
-
-  // Create the array of seeds and pass them to G4Random.  Currently,
-  // only 100 seeds can be specified at a time.  If less than 100
-  // seeds are specified, the remaining slots are set to 0.
-
-  constexpr int max_number_of_seeds{100};
-  std::vector<long> seedVec(max_number_of_seeds, 0);
-  for (std::size_t index{0}; index < seeds.size(); ++index) {
-    seedVec[index] = static_cast<long>(seeds[index]);
-  }
-
-  // Pass the array of seeds to the random engine.
-  G4Random::setTheSeeds(seedVec.data());
-}
-
 }  // namespace simcore
 
 DECLARE_PRODUCER_NS(simcore, Simulator)
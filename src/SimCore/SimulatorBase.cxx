@@ -1,5 +1,8 @@
 #include "SimCore/SimulatorBase.h"
 
+#include "Randomize.hh"
+#include "SimCore/StartupTimers.h"
+
 namespace simcore {
 
 const std::vector<std::string> SimulatorBase::invalidCommands_ = {
@@ -26,6 +29,17 @@ void SimulatorBase::updateEventHeader(ldmx::EventHeader& eventHeader) const {
                                 event_info->getENEnergy());
   eventHeader.setFloatParameter("db_material_z",
                                 event_info->getDarkBremMaterialZ());
+
+  // cost of simulating this event
+  eventHeader.setIntParameter("num_steps", event_info->getStepCount());
+  eventHeader.setIntParameter("num_tracks_created",
+                              event_info->getTracksCreated());
+  eventHeader.setIntParameter("num_tracks_saved",
+                              event_info->getTracksSaved());
+  eventHeader.setIntParameter("peak_stack_size",
+                              event_info->getPeakStackSize());
+  eventHeader.setFloatParameter("event_cpu_time", event_info->getCPUTime());
+  eventHeader.setFloatParameter("event_wall_time", event_info->getWallTime());
 }
 void SimulatorBase::onProcessEnd() {
   runManager_->TerminateEventLoop();
@@ -106,10 +120,13 @@ void SimulatorBase::verifyParameters() const {
 }
 
 void SimulatorBase::configure(framework::config::Parameters& parameters) {
+  auto timer{StartupTimers::time("configure")};
   // parameters used to configure the simulation
   parameters_ = parameters;
   // Set the verbosity level.  The default level  is 0.
   verbosity_ = parameters_.getParameter<int>("verbosity");
+  compactEventSeeds_ =
+      parameters_.getParameter<bool>("compact_event_seeds", false);
 
   preInitCommands_ =
       parameters_.getParameter<std::vector<std::string>>("preInitCommands", {});
@@ -162,20 +179,59 @@ void SimulatorBase::createLogging() {
     uiManager_->SetCoutDestination(sessionHandle_.get());
 }
 
+void SimulatorBase::terminateEvent() {
+  g4user::TrackingAction::get()->getTrackMap().traceAncestry();
+  SensitiveDetector::Factory::get().apply([](auto sd) { sd->prepareHits(); });
+  runManager_->TerminateOneEvent();
+}
+
 void SimulatorBase::saveTracks(framework::Event& event) {
   TrackMap& tracks{g4user::TrackingAction::get()->getTrackMap()};
-  tracks.traceAncestry();
   event.add("SimParticles", tracks.getParticleMap());
 }
 void SimulatorBase::saveSDHits(framework::Event& event) {
   // Copy hit objects from SD hit collections into the output event.
   SensitiveDetector::Factory::get().apply([&event](auto sd) {
+    event.getEventHeader().setIntParameter("num_hits_" + sd->GetName(),
+                                           sd->getNumHits());
+    if (sd->hasReadoutCuts()) {
+      event.getEventHeader().setFloatParameter("dropped_edep_" + sd->GetName(),
+                                               sd->getDroppedEnergy());
+    }
     sd->saveHits(event);
     sd->OnFinishedEvent();
   });
 }
 
+void SimulatorBase::setSeeds(std::vector<int> seeds) {
+  // If no seeds have been specified then return immediately.
+  if (seeds.empty()) {
+    return;
+  }
+
+  // If seeds are specified, make sure that the container has at least
+  // two seeds.  If not, throw an exception.
+  if (seeds.size() == 1) {
+    EXCEPTION_RAISE("ConfigurationException",
+                    "At least two seeds need to be specified.");
+  }
+
+  // Create the array of seeds and pass them to G4Random.  Currently,
+  // only 100 seeds can be specified at a time.  If less than 100
+  // seeds are specified, the remaining slots are set to 0.
+
+  constexpr int max_number_of_seeds{100};
+  std::vector<long> seedVec(max_number_of_seeds, 0);
+  for (std::size_t index{0}; index < seeds.size(); ++index) {
+    seedVec[index] = static_cast<long>(seeds[index]);
+  }
+
+  // Pass the array of seeds to the random engine.
+  G4Random::setTheSeeds(seedVec.data());
+}
+
 void SimulatorBase::buildGeometry() {
+  auto timer{StartupTimers::time("geometry")};
   // Instantiate the GDML parser and corresponding messenger owned and
   // managed by DetectorConstruction
   auto parser{simcore::geo::ParserFactory::getInstance().createParser(
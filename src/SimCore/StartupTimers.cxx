@@ -0,0 +1,84 @@
+#include "SimCore/StartupTimers.h"
+
+/*~~~~~~~~~~~~~~~~*/
+/*   C++ StdLib   */
+/*~~~~~~~~~~~~~~~~*/
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <unistd.h>
+
+/*~~~~~~~~~~~~~~~*/
+/*   Framework   */
+/*~~~~~~~~~~~~~~~*/
+#include "Framework/RunHeader.h"
+
+namespace simcore {
+
+StartupTimers::Phase::Phase(const std::string& name)
+    : name_{name},
+      wall_start_{std::chrono::steady_clock::now()},
+      cpu_start_{std::clock()},
+      rss_start_{StartupTimers::currentRSS()} {}
+
+StartupTimers::Phase::~Phase() {
+  std::chrono::duration<double> wall{std::chrono::steady_clock::now() -
+                                     wall_start_};
+  double cpu{static_cast<double>(std::clock() - cpu_start_) / CLOCKS_PER_SEC};
+  StartupTimers::getInstance().record(name_, wall.count(), cpu,
+                                      StartupTimers::currentRSS() - rss_start_);
+}
+
+StartupTimers& StartupTimers::getInstance() {
+  static StartupTimers instance;
+  return instance;
+}
+
+void StartupTimers::record(const std::string& name, double wall, double cpu,
+                           double rss) {
+  auto it{std::find_if(records_.begin(), records_.end(),
+                       [&name](const Record& r) { return r.name == name; })};
+  if (it == records_.end()) {
+    records_.push_back({name, wall, cpu, rss});
+  } else {
+    it->wall += wall;
+    it->cpu += cpu;
+    it->rss += rss;
+  }
+}
+
+void StartupTimers::recordConfig(ldmx::RunHeader& header) const {
+  for (const auto& r : records_) {
+    header.setFloatParameter("Startup " + r.name + " Wall Time [s]", r.wall);
+    header.setFloatParameter("Startup " + r.name + " CPU Time [s]", r.cpu);
+    header.setFloatParameter("Startup " + r.name + " RSS Delta [MB]", r.rss);
+  }
+}
+
+void StartupTimers::print(std::ostream& out) const {
+  // restore the formatting of the stream when we are done
+  std::ios_base::fmtflags flags{out.flags()};
+  std::streamsize precision{out.precision()};
+  out << "[ StartupTimers ] : Wall [s]    CPU [s]    RSS Delta [MB]  Phase"
+      << std::endl;
+  for (const auto& r : records_) {
+    out << "[ StartupTimers ] : " << std::fixed << std::setprecision(3)
+        << std::setw(8) << r.wall << "  " << std::setw(9) << r.cpu << "  "
+        << std::setw(14) << std::setprecision(1) << r.rss << "  " << r.name
+        << std::endl;
+  }
+  out.flags(flags);
+  out.precision(precision);
+}
+
+double StartupTimers::currentRSS() {
+  // the second entry in statm is the number of resident pages
+  std::ifstream statm{"/proc/self/statm"};
+  long size{0}, resident{0};
+  if (!(statm >> size >> resident)) return 0.;
+  return static_cast<double>(resident) * ::sysconf(_SC_PAGESIZE) /
+         (1024. * 1024.);
+}
+
+}  // namespace simcore
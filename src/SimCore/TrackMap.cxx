@@ -1,5 +1,9 @@
 #include "SimCore/TrackMap.h"
 
+// LDMX
+#include "SimCore/ProcessRegistry.h"
+#include "SimCore/UserRegionInformation.h"
+
 // Geant4
 #include "G4Event.hh"
 #include "G4EventManager.hh"
@@ -7,27 +11,23 @@
 namespace simcore {
 
 void TrackMap::insert(const G4Track* track) {
-  ancestry_[track->GetTrackID()] =
-      std::make_pair(track->GetParentID(), isInCalorimeterRegion(track));
-  descendents_[track->GetParentID()].push_back(track->GetTrackID());
+  std::size_t id = track->GetTrackID();
+  int parent = track->GetParentID();
+  // resizing grows the capacity geometrically, not one track at a time
+  if (id >= ancestry_.size()) ancestry_.resize(id + 1);
+  ancestry_[id].parent = parent;
+  if (parent == 0 or not isInCalorimeterRegion(track)) {
+    // this track is a primary or originated outside of the cal region
+    ancestry_[id].incident = id;
+  } else {
+    // still in cal region, same incident as the parent
+    ancestry_[id].incident = ancestry_.at(parent).incident;
+  }
+  inserted_.push_back(id);
 }
 
 int TrackMap::findIncident(G4int trackID) const {
-  int currTrackID = trackID;
-  bool foundIncident{false};
-  while (not foundIncident) {
-    auto& [parentID, inCalRegion] = ancestry_.at(currTrackID);
-    if (not inCalRegion or parentID == 0) {
-      // current track ID is nearest ancestor
-      // originating outside cal region
-      // or is a primary particle
-      foundIncident = true;
-    } else {
-      // still in cal region, keep going
-      currTrackID = parentID;
-    }
-  }
-  return currTrackID;
+  return ancestry_.at(trackID).incident;
 }
 
 void TrackMap::save(const G4Track* track) {
@@ -67,8 +67,7 @@ void TrackMap::save(const G4Track* track) {
 
   const G4VProcess* process{track->GetCreatorProcess()};
   if (process) {
-    const G4String& name{process->GetProcessName()};
-    particle.setProcessType(ldmx::SimParticle::findProcessType(name));
+    particle.setProcessType(ProcessRegistry::getInstance().getType(process));
   } else {
     if (track->GetParentID() == 0) {
       particle.setProcessType(ldmx::SimParticle::ProcessType::Primary);
@@ -88,30 +87,46 @@ void TrackMap::save(const G4Track* track) {
 }
 
 void TrackMap::traceAncestry() {
+  // count the children of each parent, shifted by one so that the
+  // prefix sum gives the offset of the first child of each parent
+  offsets_.assign(ancestry_.size() + 1, 0);
+  for (int child : inserted_) offsets_[ancestry_[child].parent + 1]++;
+  for (std::size_t i{1}; i < offsets_.size(); i++) {
+    offsets_[i] += offsets_[i - 1];
+  }
+
+  // fill the children in insertion order, using the offset of each
+  // parent as a cursor. This leaves each offset at the start of the
+  // range of the next parent, so they are then shifted back by one.
+  descendents_.resize(inserted_.size());
+  for (int child : inserted_) {
+    descendents_[offsets_[ancestry_[child].parent]++] = child;
+  }
+  for (std::size_t i{offsets_.size() - 1}; i > 0; i--) {
+    offsets_[i] = offsets_[i - 1];
+  }
+  offsets_[0] = 0;
+
   for (auto& [id, particle] : particle_map_) {
-    particle.addParent(ancestry_.at(id).first);
-
-    /**
-     * Use [] instead of at() for descendents_
-     * so that if it wasn't previously created,
-     * we will just silently create an empty
-     * vector and move on.
-     */
-    for (auto& child : descendents_[id]) {
-      particle.addDaughter(child);
+    particle.addParent(ancestry_.at(id).parent);
+    for (std::size_t i{offsets_[id]}; i < offsets_[id + 1]; i++) {
+      particle.addDaughter(descendents_[i]);
     }
   }
 }
 
 void TrackMap::clear() {
+  // clear keeps the capacity of the vectors
   ancestry_.clear();
+  inserted_.clear();
+  offsets_.clear();
   descendents_.clear();
   particle_map_.clear();
 }
 
 bool TrackMap::isInCalorimeterRegion(const G4Track* track) const {
-  auto region{track->GetLogicalVolumeAtVertex()->GetRegion()->GetName()};
-  return region.contains("Calorimeter");
+  auto region_info{UserRegionInformation::get(track)};
+  return region_info and region_info->isCalorimeter();
 }
 
 }  // namespace simcore
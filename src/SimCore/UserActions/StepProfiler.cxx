@@ -0,0 +1,188 @@
+#include "SimCore/UserActions/StepProfiler.h"
+
+/*~~~~~~~~~~~~~~~~*/
+/*   C++ StdLib   */
+/*~~~~~~~~~~~~~~~~*/
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+
+/*~~~~~~~~~~~~*/
+/*   Geant4   */
+/*~~~~~~~~~~~~*/
+#include "G4LogicalVolume.hh"
+#include "G4ParticleDefinition.hh"
+#include "G4Region.hh"
+#include "G4Step.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4Track.hh"
+#include "G4VPhysicalVolume.hh"
+#include "G4VProcess.hh"
+
+/*~~~~~~~~~~~~~*/
+/*   SimCore   */
+/*~~~~~~~~~~~~~*/
+#include "SimCore/SensitiveDetector.h"
+
+namespace simcore {
+namespace useractions {
+
+StepProfiler::SDTimer::SDTimer(StepProfiler& profiler, SensitiveDetector* sd)
+    : G4VSDFilter(sd->GetName() + "_timer"), profiler_{profiler}, sd_{sd} {}
+
+G4bool StepProfiler::SDTimer::Accept(const G4Step*) const {
+  if (profiler_.sampling_) {
+    profiler_.sd_ = sd_;
+    profiler_.sd_start_ = std::chrono::steady_clock::now();
+  }
+  return true;
+}
+
+StepProfiler::StepProfiler(const std::string& name,
+                           framework::config::Parameters& parameters)
+    : UserAction(name, parameters) {
+  sample_period_ = parameters.getParameter<int>("sample_period");
+  max_rows_ = parameters.getParameter<int>("max_rows");
+  if (sample_period_ < 1) {
+    EXCEPTION_RAISE("StepProfiler", "The sample period must be at least 1.");
+  }
+  countdown_ = sample_period_;
+}
+
+void StepProfiler::BeginOfRunAction(const G4Run*) {
+  // Geant4 owns the filters, we only keep track of which SDs we attached
+  // them to so that we can detach them at the end of the run
+  SensitiveDetector::Factory::get().apply([this](auto sd) {
+    if (sd->GetFilter() == nullptr) {
+      sd->SetFilter(new SDTimer(*this, sd));
+      timed_sds_.push_back(sd);
+    }
+  });
+}
+
+void StepProfiler::EndOfRunAction(const G4Run*) {
+  for (auto sd : timed_sds_) sd->SetFilter(nullptr);
+  timed_sds_.clear();
+
+  auto rows = [](const auto& stats, auto name) {
+    std::vector<std::pair<std::string, Stat>> r;
+    for (const auto& [key, stat] : stats) r.emplace_back(name(key), stat);
+    return r;
+  };
+
+  printTable("Logical Volume",
+             rows(by_volume_, [](const G4LogicalVolume* lv) {
+               return std::string(lv ? lv->GetName() : "none");
+             }));
+  printTable("Region", rows(by_region_, [](const G4Region* region) {
+               return std::string(region ? region->GetName() : "none");
+             }));
+  printTable("PDG",
+             rows(by_pdg_, [](int pdg) { return std::to_string(pdg); }));
+  printTable("Process", rows(by_process_, [](const G4VProcess* process) {
+               return std::string(process ? process->GetProcessName()
+                                          : "none");
+             }));
+
+  std::vector<std::pair<std::string, Stat>> energy_rows;
+  for (std::size_t bin{0}; bin < NUM_ENERGY_BINS; bin++) {
+    std::string name;
+    if (bin == 0) {
+      name = "< 1 keV";
+    } else if (bin == NUM_ENERGY_BINS - 1) {
+      name = ">= 10 TeV";
+    } else {
+      name = "[1e" + std::to_string(bin - 1) + ", 1e" + std::to_string(bin) +
+             ") keV";
+    }
+    energy_rows.emplace_back(name, by_energy_[bin]);
+  }
+  printTable("Kinetic Energy", energy_rows);
+
+  printTable("SD ProcessHits", rows(by_sd_, [](const SensitiveDetector* sd) {
+               return std::string(sd->GetName());
+             }));
+}
+
+void StepProfiler::stepping(const G4Step* step) {
+  const G4Track* track{step->GetTrack()};
+
+  if (sampling_) {
+    auto now{std::chrono::steady_clock::now()};
+    // only attribute the time if the sampled step continued the same
+    // track, otherwise it also includes the start of a new track
+    if (track->GetTrackID() == sampled_track_id_) {
+      double time{std::chrono::duration<double>(now - step_start_).count()};
+      auto add = [time](Stat& stat) {
+        stat.samples++;
+        stat.time += time;
+      };
+
+      const G4StepPoint* pre{step->GetPreStepPoint()};
+      const G4VPhysicalVolume* physical{pre->GetPhysicalVolume()};
+      const G4LogicalVolume* volume{physical ? physical->GetLogicalVolume()
+                                             : nullptr};
+      add(by_volume_[volume]);
+      add(by_region_[volume ? volume->GetRegion() : nullptr]);
+      add(by_pdg_[track->GetDefinition()->GetPDGEncoding()]);
+      add(by_process_[step->GetPostStepPoint()->GetProcessDefinedStep()]);
+      add(by_energy_[energyBin(pre->GetKineticEnergy())]);
+
+      if (sd_) {
+        Stat& stat{by_sd_[sd_]};
+        stat.samples++;
+        stat.time += std::chrono::duration<double>(now - sd_start_).count();
+      }
+    }
+    sampling_ = false;
+    sd_ = nullptr;
+  }
+
+  // sample the next step, starting the clock as late as possible
+  if (--countdown_ == 0) {
+    countdown_ = sample_period_;
+    sampling_ = true;
+    sampled_track_id_ = track->GetTrackID();
+    step_start_ = std::chrono::steady_clock::now();
+  }
+}
+
+std::size_t StepProfiler::energyBin(double energy) {
+  if (energy < 1 * keV) return 0;
+  auto decade{static_cast<std::size_t>(std::log10(energy / keV)) + 1};
+  return std::min(decade, NUM_ENERGY_BINS - 1);
+}
+
+void StepProfiler::printTable(
+    const std::string& axis,
+    std::vector<std::pair<std::string, Stat>> rows) const {
+  std::sort(rows.begin(), rows.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.second.time > rhs.second.time;
+  });
+
+  double total_time{0.};
+  for (const auto& row : rows) total_time += row.second.time;
+
+  std::cout << "[ StepProfiler ] : Steps and time by " << axis
+            << " (estimated from 1 in " << sample_period_ << " steps)\n"
+            << std::setw(14) << "Steps" << std::setw(14) << "Time [s]"
+            << std::setw(9) << "Time %" << "  " << axis << "\n";
+  int printed{0};
+  for (const auto& [name, stat] : rows) {
+    if (stat.samples == 0) continue;
+    if (printed++ == max_rows_) break;
+    std::cout << std::setw(14) << stat.samples * sample_period_
+              << std::setw(14) << std::fixed << std::setprecision(3)
+              << stat.time * sample_period_ << std::setw(9)
+              << std::setprecision(1)
+              << (total_time > 0 ? 100. * stat.time / total_time : 0.) << "  "
+              << name << "\n";
+  }
+  std::cout << std::defaultfloat << std::flush;
+}
+
+}  // namespace useractions
+}  // namespace simcore
+
+DECLARE_ACTION(simcore::useractions, StepProfiler)
@@ -14,4 +14,21 @@ void UserEventInformation::Print() const {
             << "E_{EN} = " << total_electronuclear_energy_ << " MeV"
             << std::endl;
 }
+
+void UserEventInformation::startTimers() {
+  wall_start_ = std::chrono::steady_clock::now();
+  // the CPU time of only this thread so that the time is not inflated
+  // by the other threads of the process
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_start_);
+}
+
+void UserEventInformation::stopTimers() {
+  std::chrono::duration<double> wall{std::chrono::steady_clock::now() -
+                                     wall_start_};
+  wall_time_ = wall.count();
+  timespec cpu_stop;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &cpu_stop);
+  cpu_time_ = static_cast<double>(cpu_stop.tv_sec - cpu_start_.tv_sec) +
+              static_cast<double>(cpu_stop.tv_nsec - cpu_start_.tv_nsec) * 1e-9;
+}
 }  // namespace simcore
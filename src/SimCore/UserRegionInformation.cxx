@@ -2,12 +2,9 @@
 
 namespace simcore {
 
-UserRegionInformation::UserRegionInformation(bool aStoreSecondaries)
-    : storeSecondaries_(aStoreSecondaries) {}
-
-bool UserRegionInformation::getStoreSecondaries() const {
-  return storeSecondaries_;
-}
+UserRegionInformation::UserRegionInformation(bool aStoreSecondaries,
+                                             bool aIsCalorimeter)
+    : storeSecondaries_(aStoreSecondaries), isCalorimeter_(aIsCalorimeter) {}
 
 void UserRegionInformation::Print() const {}
 
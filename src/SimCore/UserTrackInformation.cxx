@@ -5,8 +5,31 @@
 /*~~~~~~~~~~~~~~~~*/
 #include <iostream>
 
+/*~~~~~~~~~~~~*/
+/*   Geant4   */
+/*~~~~~~~~~~~~*/
+#include "G4Allocator.hh"
+
 namespace simcore {
 
+namespace {
+/// allocator of the track information of this thread
+G4ThreadLocal G4Allocator<UserTrackInformation>* track_info_allocator{nullptr};
+}  // namespace
+
+void* UserTrackInformation::operator new(std::size_t) {
+  if (not track_info_allocator) {
+    track_info_allocator = new G4Allocator<UserTrackInformation>;
+  }
+  return track_info_allocator->MallocSingle();
+}
+
+void UserTrackInformation::operator delete(void* ptr) {
+  if (ptr) {
+    track_info_allocator->FreeSingle(static_cast<UserTrackInformation*>(ptr));
+  }
+}
+
 UserTrackInformation* UserTrackInformation::get(const G4Track* track) {
   if (!track->GetUserInformation()) {
     const_cast<G4Track*>(track)->SetUserInformation(new UserTrackInformation);
@@ -16,7 +39,7 @@ UserTrackInformation* UserTrackInformation::get(const G4Track* track) {
 
 void UserTrackInformation::initialize(const G4Track* track) {
   initialMomentum_ = track->GetMomentum();
-  vertexVolume_ = track->GetLogicalVolumeAtVertex()->GetName();
+  vertexVolume_ = track->GetLogicalVolumeAtVertex();
   vertex_time_ = track->GetGlobalTime();
 }
 void UserTrackInformation::Print() const {
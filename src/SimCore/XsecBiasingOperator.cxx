@@ -26,7 +26,8 @@ void XsecBiasingOperator::StartRun() {
   std::cout << "[ XsecBiasingOperator ]: Biasing particles of type "
             << this->getParticleToBias() << std::endl;
 
-  if (processIsBiased(this->getProcessToBias())) {
+  processToBias_ = findBiasedProcess(this->getProcessToBias());
+  if (processToBias_) {
     xsecOperation_ =
         new G4BOptnChangeCrossSection("changeXsec-" + this->getProcessToBias());
   } else {
@@ -37,7 +38,12 @@ void XsecBiasingOperator::StartRun() {
 }
 
 bool XsecBiasingOperator::processIsBiased(std::string process) {
-  // Loop over all processes and check if the given process is being
+  return findBiasedProcess(process) != nullptr;
+}
+
+const G4VProcess* XsecBiasingOperator::findBiasedProcess(
+    const std::string& process) const {
+  // Loop over all processes and find the given process if it is being
   // biased.
   const G4BiasingProcessSharedData* sharedData =
       G4BiasingProcessInterface::GetSharedData(processManager_);
@@ -50,11 +56,11 @@ bool XsecBiasingOperator::processIsBiased(std::string process) {
 
       if (wrapperProcess->GetWrappedProcess()->GetProcessName().compareTo(
               process) == 0) {
-        return true;
+        return wrapperProcess->GetWrappedProcess();
       }
     }
   }
-  return false;
+  return nullptr;
 }
 
 }  // namespace simcore
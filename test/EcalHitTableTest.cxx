@@ -0,0 +1,204 @@
+#include <algorithm>
+#include <catch2/catch_approx.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <map>
+#include <random>
+#include <vector>
+
+#include "DetDescr/EcalID.h"
+#include "SimCore/Event/SimCalorimeterHit.h"
+#include "SimCore/SDs/EcalHitTable.h"
+
+namespace simcore {
+namespace test {
+
+/// A step in an ECal cell as the EcalSD sees it
+struct EcalStep {
+  ldmx::EcalID id;
+  int incident_id;
+  int track_id;
+  int pdg;
+  double edep;
+  double time;
+};
+
+/**
+ * Make the steps of an event
+ *
+ * The steps of a track are in time order and all in cells near each
+ * other, and the tracks have fixed PDG IDs and incidents, like in a
+ * shower. Cells are spread over all the layers and modules with the
+ * same cell numbers so that the table sees its worst case.
+ */
+std::vector<EcalStep> makeEvent(std::mt19937& rng, int n_tracks) {
+  std::uniform_int_distribution<int> layer(0, 33), module(0, 6),
+      cell(200, 210), n_steps(1, 40), step(-1, 1);
+  std::uniform_real_distribution<double> edep(0., 1.), dt(0.001, 0.1);
+  const std::vector<int> pdgs{11, -11, 22, 2112, 2212};
+
+  std::vector<EcalStep> steps;
+  for (int track_id{1}; track_id <= n_tracks; track_id++) {
+    int incident_id{1 + track_id / 10};
+    int pdg{pdgs[track_id % pdgs.size()]};
+    int l{layer(rng)}, m{module(rng)}, c{cell(rng)};
+    double time{1. + 0.01 * track_id};
+    for (int i_step{n_steps(rng)}; i_step > 0; i_step--) {
+      steps.push_back({ldmx::EcalID(l, m, c), incident_id, track_id, pdg,
+                       edep(rng), time});
+      // stay in the same cell or move to a neighbouring layer
+      l = std::clamp(l + step(rng), 0, 33);
+      time += dt(rng);
+    }
+  }
+  // tracks are not processed one after the other in a shower, so the
+  // steps of different tracks are interleaved while each track stays
+  // in time order
+  std::vector<EcalStep> interleaved;
+  std::vector<std::size_t> begin, end;
+  for (std::size_t i{0}; i < steps.size(); i++) {
+    if (i == 0 or steps[i].track_id != steps[i - 1].track_id) {
+      begin.push_back(i);
+      end.push_back(i);
+    }
+    end.back()++;
+  }
+  std::uniform_int_distribution<std::size_t> pick(0, begin.size() - 1);
+  while (interleaved.size() < steps.size()) {
+    std::size_t track{pick(rng)};
+    if (begin[track] < end[track]) {
+      interleaved.push_back(steps[begin[track]++]);
+    }
+  }
+  return interleaved;
+}
+
+/**
+ * Make the hits the way the EcalSD did before the hit table: a map from
+ * the cell ID to its hit and the contributions added to the hit directly
+ */
+std::vector<ldmx::SimCalorimeterHit> baselineHits(
+    const std::vector<EcalStep>& steps, bool enable_contribs,
+    bool compress_contribs) {
+  std::map<ldmx::EcalID, ldmx::SimCalorimeterHit> hits;
+  for (const auto& step : steps) {
+    auto& hit{hits[step.id]};
+    hit.setID(step.id.raw());
+    if (enable_contribs) {
+      int contrib_i = hit.findContribIndex(step.track_id, step.pdg);
+      if (compress_contribs and contrib_i != -1) {
+        hit.updateContrib(contrib_i, step.edep, step.time);
+      } else {
+        hit.addContrib(step.incident_id, step.track_id, step.pdg, step.edep,
+                       step.time);
+      }
+    } else {
+      hit.setEdep(hit.getEdep() + step.edep);
+      if (step.time < hit.getTime() or hit.getTime() == 0) {
+        hit.setTime(step.time);
+      }
+    }
+  }
+  std::vector<ldmx::SimCalorimeterHit> squashed;
+  for (const auto& [id, hit] : hits) squashed.push_back(hit);
+  return squashed;
+}
+
+/**
+ * Fill the table with the steps and stage its hits
+ */
+void tableHits(EcalHitTable& table, const std::vector<EcalStep>& steps,
+               std::vector<ldmx::SimCalorimeterHit>& hits) {
+  table.clear();
+  for (const auto& step : steps) {
+    bool created{false};
+    std::size_t i_hit{table.findHit(step.id, created)};
+    if (created) table.getHit(i_hit).setID(step.id.raw());
+    table.addStep(i_hit, step.incident_id, step.track_id, step.pdg, step.edep,
+                  step.time);
+  }
+  table.stage(hits);
+}
+
+/**
+ * Check that two lists of hits are the same
+ *
+ * The table sums the energy of the contributions in a different order
+ * than the hits did, so the energies only agree to rounding.
+ */
+void checkSame(const std::vector<ldmx::SimCalorimeterHit>& hits,
+               const std::vector<ldmx::SimCalorimeterHit>& expected) {
+  REQUIRE(hits.size() == expected.size());
+  for (std::size_t i_hit{0}; i_hit < hits.size(); i_hit++) {
+    const auto& hit{hits[i_hit]};
+    const auto& expected_hit{expected[i_hit]};
+    CHECK(hit.getID() == expected_hit.getID());
+    CHECK(hit.getEdep() == Catch::Approx(expected_hit.getEdep()));
+    CHECK(hit.getTime() == expected_hit.getTime());
+    REQUIRE(hit.getNumberOfContribs() == expected_hit.getNumberOfContribs());
+    for (unsigned i{0}; i < hit.getNumberOfContribs(); i++) {
+      auto contrib{hit.getContrib(i)};
+      auto expected_contrib{expected_hit.getContrib(i)};
+      CHECK(contrib.incidentID == expected_contrib.incidentID);
+      CHECK(contrib.trackID == expected_contrib.trackID);
+      CHECK(contrib.pdgCode == expected_contrib.pdgCode);
+      CHECK(contrib.edep == Catch::Approx(expected_contrib.edep));
+      CHECK(contrib.time == expected_contrib.time);
+    }
+  }
+}
+
+/**
+ * Fill the table with a few events of different sizes, reusing it like
+ * the EcalSD does, and compare each event to the baseline
+ */
+void checkEvents(bool enable_contribs, bool compress_contribs) {
+  std::mt19937 rng(42);
+  EcalHitTable table(enable_contribs, compress_contribs);
+  std::vector<ldmx::SimCalorimeterHit> hits;
+  // the large event grows the tables past their initial sizes
+  for (int n_tracks : {100, 3000, 10, 500}) {
+    auto steps{makeEvent(rng, n_tracks)};
+    tableHits(table, steps, hits);
+    checkSame(hits, baselineHits(steps, enable_contribs, compress_contribs));
+  }
+}
+
+}  // namespace test
+}  // namespace simcore
+
+TEST_CASE("EcalHitTable matches the hits made per step",
+          "[SimCore][EcalHitTable]") {
+  SECTION("compressed contributions") {
+    simcore::test::checkEvents(true, true);
+  }
+  SECTION("a contribution per step") {
+    simcore::test::checkEvents(true, false);
+  }
+  SECTION("no contributions") { simcore::test::checkEvents(false, false); }
+}
+
+TEST_CASE("EcalHitTable clears between events", "[SimCore][EcalHitTable]") {
+  simcore::EcalHitTable table(true, true);
+  std::vector<ldmx::SimCalorimeterHit> hits;
+
+  bool created{false};
+  std::size_t i_hit{table.findHit(ldmx::EcalID(1, 2, 3), created)};
+  CHECK(created);
+  CHECK(table.findHit(ldmx::EcalID(1, 2, 3), created) == i_hit);
+  CHECK_FALSE(created);
+  table.addStep(i_hit, 1, 1, 11, 1., 1.);
+  table.stage(hits);
+  CHECK(hits.size() == 1);
+  table.clear();
+
+  // the same cell is a new hit in the next event
+  i_hit = table.findHit(ldmx::EcalID(1, 2, 3), created);
+  CHECK(created);
+  CHECK(table.getHit(i_hit).getNumberOfContribs() == 0);
+  table.addStep(i_hit, 2, 2, 22, 2., 2.);
+  table.stage(hits);
+  REQUIRE(hits.size() == 1);
+  REQUIRE(hits[0].getNumberOfContribs() == 1);
+  CHECK(hits[0].getContrib(0).trackID == 2);
+  CHECK(hits[0].getEdep() == Catch::Approx(2.));
+}
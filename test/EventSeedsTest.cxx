@@ -0,0 +1,111 @@
+#include <catch2/catch_test_macros.hpp>
+#include <set>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "Framework/EventHeader.h"
+#include "Framework/Exception/Exception.h"
+#include "Framework/RunHeader.h"
+#include "Randomize.hh"
+#include "SimCore/EventSeeds.h"
+
+namespace simcore {
+namespace test {
+
+/// Draw a few numbers from the random engine
+std::vector<double> draw() {
+  std::vector<double> numbers;
+  for (int i{0}; i < 10; i++) numbers.push_back(G4UniformRand());
+  return numbers;
+}
+
+}  // namespace test
+}  // namespace simcore
+
+TEST_CASE("Derived event seeds", "[SimCore][EventSeeds]") {
+  const std::vector<int> run_seeds{1, 2};
+  const int run{9001};
+
+  SECTION("are reproducible") {
+    for (int event{1}; event < 100; event++) {
+      CHECK(simcore::deriveEventSeeds(run_seeds, run, event) ==
+            simcore::deriveEventSeeds(run_seeds, run, event));
+    }
+  }
+
+  SECTION("are two valid seeds for every event") {
+    // positive seeds survive the event header and never end the array
+    // of seeds given to the engine early
+    std::set<std::pair<int, int>> seen;
+    for (int event{1}; event <= 100000; event++) {
+      auto seeds{simcore::deriveEventSeeds(run_seeds, run, event)};
+      REQUIRE(seeds.size() == 2);
+      CHECK(seeds[0] > 0);
+      CHECK(seeds[1] > 0);
+      // sequential events do not share their seeds
+      CHECK(seen.emplace(seeds[0], seeds[1]).second);
+    }
+  }
+
+  SECTION("depend on the run seeds and run number") {
+    auto seeds{simcore::deriveEventSeeds(run_seeds, run, 1)};
+    CHECK(seeds != simcore::deriveEventSeeds({2, 1}, run, 1));
+    CHECK(seeds != simcore::deriveEventSeeds({1, 3}, run, 1));
+    CHECK(seeds != simcore::deriveEventSeeds(run_seeds, run + 1, 1));
+    // the run and event numbers are not interchangeable
+    CHECK(simcore::deriveEventSeeds(run_seeds, 1, 2) !=
+          simcore::deriveEventSeeds(run_seeds, 2, 1));
+  }
+
+  SECTION("need the seeds of the run") {
+    CHECK_THROWS_AS(simcore::deriveEventSeeds({}, run, 1),
+                    framework::exception::Exception);
+    CHECK_THROWS_AS(simcore::deriveEventSeeds({1}, run, 1),
+                    framework::exception::Exception);
+  }
+}
+
+TEST_CASE("Restored event seeds", "[SimCore][EventSeeds]") {
+  using simcore::test::draw;
+  long run_seeds[]{1, 2, 0};
+  G4Random::setTheSeeds(run_seeds);
+
+  SECTION("the mode is recorded in the run header") {
+    ldmx::RunHeader header(9001);
+    // runs from before the mode was recorded stored the full state
+    CHECK_FALSE(simcore::hasCompactEventSeeds(header));
+    header.setIntParameter(simcore::COMPACT_EVENT_SEEDS_PARAMETER, 0);
+    CHECK_FALSE(simcore::hasCompactEventSeeds(header));
+    header.setIntParameter(simcore::COMPACT_EVENT_SEEDS_PARAMETER, 1);
+    CHECK(simcore::hasCompactEventSeeds(header));
+  }
+
+  SECTION("from the full state of the engine") {
+    // advance the engine so its state isn't the one it was seeded with
+    draw();
+    ldmx::EventHeader header;
+    std::ostringstream stream;
+    G4Random::saveFullState(stream);
+    header.setStringParameter("eventSeed", stream.str());
+    auto numbers{draw()};
+
+    draw();
+    simcore::restoreEventSeeds(header, false);
+    CHECK(draw() == numbers);
+  }
+
+  SECTION("from compact seeds") {
+    auto seeds{simcore::deriveEventSeeds({1, 2}, 9001, 3)};
+    ldmx::EventHeader header;
+    header.setIntParameter("eventSeed0", seeds.at(0));
+    header.setIntParameter("eventSeed1", seeds.at(1));
+    long event_seeds[]{seeds.at(0), seeds.at(1), 0};
+    G4Random::setTheSeeds(event_seeds);
+    auto numbers{draw()};
+
+    draw();
+    simcore::restoreEventSeeds(header, true);
+    CHECK(draw() == numbers);
+  }
+}
@@ -0,0 +1,105 @@
+#include <catch2/catch_test_macros.hpp>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "SimCore/Event/SimCalorimeterHit.h"
+
+namespace simcore {
+namespace test {
+
+/**
+ * Find a contribution by looking through all of them, like the hit does
+ * before it has enough contributions to index them
+ */
+int linearFind(const ldmx::SimCalorimeterHit& hit, int track_id, int pdg) {
+  for (unsigned i{0}; i < hit.getNumberOfContribs(); i++) {
+    auto contrib{hit.getContrib(i)};
+    if (contrib.trackID == track_id and contrib.pdgCode == pdg) return i;
+  }
+  return -1;
+}
+
+/**
+ * Check that the hit finds the same contribution as the linear search
+ * for every track and PDG ID it could have, including ones it doesn't
+ */
+void checkLookups(const ldmx::SimCalorimeterHit& hit) {
+  for (int track_id{0}; track_id <= 30; track_id++) {
+    for (int pdg : {11, 22, -11}) {
+      CHECK(hit.findContribIndex(track_id, pdg) ==
+            linearFind(hit, track_id, pdg));
+    }
+  }
+}
+
+/// Add a contribution from a random track and PDG ID
+void addRandomContrib(ldmx::SimCalorimeterHit& hit, std::mt19937& rng) {
+  std::uniform_int_distribution<int> track_id(1, 30), i_pdg(0, 2);
+  const int pdgs[]{11, 22, -11};
+  hit.addContrib(1, track_id(rng), pdgs[i_pdg(rng)], 1., 1.);
+}
+
+}  // namespace test
+}  // namespace simcore
+
+TEST_CASE("Indexed and linear contribution lookups agree",
+          "[SimCore][SimCalorimeterHit]") {
+  using simcore::test::addRandomContrib;
+  using simcore::test::checkLookups;
+  std::mt19937 rng(42);
+
+  SECTION("while contributions are added") {
+    ldmx::SimCalorimeterHit hit;
+    // lookups between additions build the index and keep it up to date
+    for (int i{0}; i < 40; i++) {
+      addRandomContrib(hit, rng);
+      checkLookups(hit);
+    }
+  }
+
+  SECTION("first contribution wins for duplicate keys") {
+    ldmx::SimCalorimeterHit hit;
+    for (int track_id{1}; track_id <= 12; track_id++) {
+      hit.addContrib(1, track_id, 11, 1., 1.);
+    }
+    hit.addContrib(1, 3, 11, 1., 1.);
+    // built from contributions that already have a duplicate
+    CHECK(hit.findContribIndex(3, 11) == 2);
+    // kept up to date with a duplicate added after it was built
+    hit.addContrib(1, 5, 11, 1., 1.);
+    CHECK(hit.findContribIndex(5, 11) == 4);
+    checkLookups(hit);
+  }
+
+  SECTION("copies and reused hits") {
+    ldmx::SimCalorimeterHit hit;
+    for (int i{0}; i < 20; i++) addRandomContrib(hit, rng);
+    checkLookups(hit);
+
+    // a copy carries the index along and both keep adding to their own
+    ldmx::SimCalorimeterHit copy{hit};
+    for (int i{0}; i < 10; i++) addRandomContrib(copy, rng);
+    checkLookups(copy);
+    checkLookups(hit);
+
+    // a hit given the contributions of another with an index of a
+    // different size
+    ldmx::SimCalorimeterHit smaller;
+    for (int i{0}; i < 12; i++) addRandomContrib(smaller, rng);
+    hit = smaller;
+    checkLookups(hit);
+    hit = std::move(copy);
+    checkLookups(hit);
+
+    // a cleared hit filled again
+    hit.Clear();
+    for (int i{0}; i < 15; i++) addRandomContrib(hit, rng);
+    checkLookups(hit);
+
+    // the index released and contributions added without it
+    hit.releaseContribIndex();
+    for (int i{0}; i < 5; i++) addRandomContrib(hit, rng);
+    checkLookups(hit);
+  }
+}
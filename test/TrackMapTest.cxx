@@ -0,0 +1,143 @@
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "G4Box.hh"
+#include "G4DynamicParticle.hh"
+#include "G4Geantino.hh"
+#include "G4LogicalVolume.hh"
+#include "G4NistManager.hh"
+#include "G4Region.hh"
+#include "G4Track.hh"
+#include "SimCore/TrackMap.h"
+#include "SimCore/UserRegionInformation.h"
+
+namespace simcore {
+namespace test {
+
+/**
+ * A volume in a region that is (or isn't) part of the calorimeter
+ *
+ * The TrackMap only needs the logical volume a track was created in,
+ * so no geometry has to be built or navigated.
+ */
+class Volume {
+ public:
+  Volume(const std::string& name, bool is_calorimeter)
+      : solid_{name, 1., 1., 1.},
+        volume_{&solid_,
+                G4NistManager::Instance()->FindOrBuildMaterial("G4_AIR"),
+                name},
+        region_{new G4Region(name)} {
+    region_->SetUserInformation(
+        new UserRegionInformation(true, is_calorimeter));
+    volume_.SetRegion(region_);
+  }
+
+  const G4LogicalVolume* get() const { return &volume_; }
+
+ private:
+  G4Box solid_;
+  G4LogicalVolume volume_;
+  /// deleted by the G4RegionStore
+  G4Region* region_;
+};
+
+/**
+ * Create a track as if it was just popped off the stack
+ */
+std::unique_ptr<G4Track> makeTrack(int id, int parent,
+                                   const Volume& vertex_volume) {
+  auto track{std::make_unique<G4Track>(
+      new G4DynamicParticle(G4Geantino::Definition(), G4ThreeVector(0, 0, 1)),
+      0., G4ThreeVector())};
+  track->SetTrackID(id);
+  track->SetParentID(parent);
+  track->SetLogicalVolumeAtVertex(vertex_volume.get());
+  return track;
+}
+
+}  // namespace test
+}  // namespace simcore
+
+/**
+ * Check the ancestry kept by the TrackMap
+ *
+ * The event is
+ *
+ *   1 (primary)
+ *   ├── 2 (outside)
+ *   │   ├── 3 (calorimeter)
+ *   │   │   └── 4 (calorimeter)
+ *   │   └── 6 (outside)
+ *   └── 5 (calorimeter)
+ *
+ * and the tracks are inserted in the order Geant4 could process them,
+ * which always has parents before their children.
+ */
+TEST_CASE("TrackMap ancestry and incidents", "[SimCore][TrackMap]") {
+  using simcore::test::makeTrack;
+  simcore::test::Volume outside("TrackMapTestOutside", false),
+      calorimeter("TrackMapTestCalorimeter", true);
+
+  std::vector<std::unique_ptr<G4Track>> tracks;
+  tracks.push_back(makeTrack(1, 0, outside));
+  tracks.push_back(makeTrack(2, 1, outside));
+  tracks.push_back(makeTrack(5, 1, calorimeter));
+  tracks.push_back(makeTrack(3, 2, calorimeter));
+  tracks.push_back(makeTrack(6, 2, outside));
+  tracks.push_back(makeTrack(4, 3, calorimeter));
+
+  simcore::TrackMap track_map;
+  // the map is reused between events, so fill it twice to check that
+  // nothing leaks from the first event into the second
+  for (int event{0}; event < 2; event++) {
+    track_map.clear();
+    for (const auto& track : tracks) {
+      CHECK_FALSE(track_map.contains(track.get()));
+      track_map.insert(track.get());
+      CHECK(track_map.contains(track.get()));
+    }
+
+    CHECK(track_map.findIncident(1) == 1);
+    CHECK(track_map.findIncident(2) == 2);
+    CHECK(track_map.findIncident(3) == 2);
+    CHECK(track_map.findIncident(4) == 2);
+    CHECK(track_map.findIncident(5) == 1);
+    CHECK(track_map.findIncident(6) == 6);
+
+    // keep all but track 4
+    for (const auto& track : tracks) {
+      if (track->GetTrackID() != 4) track_map.save(track.get());
+    }
+    CHECK(track_map.isSaved(3));
+    CHECK_FALSE(track_map.isSaved(4));
+
+    track_map.traceAncestry();
+    auto& particles{track_map.getParticleMap()};
+    REQUIRE(particles.size() == 5);
+
+    CHECK(particles[1].getParents() == std::vector<int>{0});
+    CHECK(particles[2].getParents() == std::vector<int>{1});
+    CHECK(particles[3].getParents() == std::vector<int>{2});
+    CHECK(particles[5].getParents() == std::vector<int>{1});
+    CHECK(particles[6].getParents() == std::vector<int>{2});
+
+    // daughters are in the order they were inserted, whether or not
+    // they are saved
+    CHECK(particles[1].getDaughters() == std::vector<int>{2, 5});
+    CHECK(particles[2].getDaughters() == std::vector<int>{3, 6});
+    CHECK(particles[3].getDaughters() == std::vector<int>{4});
+    CHECK(particles[5].getDaughters().empty());
+    CHECK(particles[6].getDaughters().empty());
+  }
+
+  // an event with fewer tracks than the one before
+  track_map.clear();
+  track_map.insert(tracks.front().get());
+  track_map.save(tracks.front().get());
+  track_map.traceAncestry();
+  CHECK_FALSE(track_map.contains(tracks[1].get()));
+  CHECK(track_map.getParticleMap()[1].getDaughters().empty());
+}